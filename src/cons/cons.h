@@ -12,6 +12,8 @@
   #include "cons_pc98.h"
 #elif defined(__PCAT__)
   #include "cons_pcat.h"
+#elif defined(CONS_USE_SERVER)
+ #include "cons_server.h"
 #else
  #include "cons_curses.h"
 #endif
@@ -0,0 +1,348 @@
+/**
+ *  @file cons_ansi.c
+ *  @brief ANSI escape sequence output of cell buffers.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ */
+#include "cons.h"
+#include "cons_text.h"
+#include "cons_ansi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ANSI_SCROLL_MAX     8   ///< Largest row move looked for.
+#define ANSI_SCROLL_GAIN    16  ///< Cells a row move must save to be worth its sequence.
+#define ANSI_SGR_MAX        48  ///< Bytes of the longest SGR.
+
+static char             s_sgr[256][ANSI_SGR_MAX];   ///< SGR of each cons_col_t. Made on first use.
+static unsigned char    s_sgrLen[256];              ///< 0:not made yet.
+
+void cons_ansiInit(cons_ansi_t* a) {
+    memset(a, 0, sizeof(*a));
+    a->x      = -1;
+    a->y      = -1;
+    a->col    = -1;
+    a->scroll = 1;
+}
+
+void cons_ansiTerm(cons_ansi_t* a) {
+    free(a->buf);
+    memset(a, 0, sizeof(*a));
+}
+
+/** Make room for n more bytes.
+ *  @return 0:out of memory.
+ */
+static int ansi_reserve(cons_ansi_t* a, unsigned n) {
+    unsigned cap;
+    char*    p;
+    if (a->len + n <= a->cap)
+        return 1;
+    cap = a->cap ? a->cap : 1024;
+    while (cap < a->len + n)
+        cap *= 2;
+    p = (char*)realloc(a->buf, cap);
+    if (!p) {
+        a->err = 1;
+        return 0;
+    }
+    a->buf = p;
+    a->cap = cap;
+    return 1;
+}
+
+/** Append n bytes.
+ */
+void cons_ansiWrite(cons_ansi_t* a, char const* s, unsigned n) {
+    if (ansi_reserve(a, n)) {
+        memcpy(a->buf + a->len, s, n);
+        a->len += n;
+    }
+}
+
+/** Remove n bytes sent to the terminal.
+ */
+void cons_ansiConsume(cons_ansi_t* a, unsigned n) {
+    if (n >= a->len) {
+        a->len = 0;
+        return;
+    }
+    memmove(a->buf, a->buf + n, a->len - n);
+    a->len -= n;
+}
+
+/** Clear the terminal and hide its cursor.
+ *  shadow is set to the cleared screen, so only non blank cells are drawn next.
+ */
+void cons_ansiReset(cons_ansi_t* a, cons_cbuf_t* shadow) {
+    static char const s[] = "\x1b[0m\x1b[?25l\x1b[H\x1b[2J";
+    cons_ansiWrite(a, s, sizeof(s) - 1);
+    a->x   = 0;
+    a->y   = 0;
+    a->col = 0;
+    if (shadow->cells)
+        cons_cbufFill(shadow, 0, 0, shadow->w, shadow->h, CELL(' ', 0));
+}
+
+/** A reply to CONS_ANSI_SYNC_QUERY. csi[0 .. n) is from after "ESC [" to the final byte.
+ *  @return 0:not the reply.
+ */
+int cons_ansiSyncReply(cons_ansi_t* a, char const* csi, unsigned n) {
+    if (n != 9 || memcmp(csi, "?2026;", 6) != 0 || memcmp(csi + 7, "$y", 2) != 0)
+        return 0;
+    a->sync = (csi[6] == '1' || csi[6] == '2');     // 1:set 2:reset. 0,4:not known.
+    return 1;
+}
+
+/** Number of cells of a[0 .. w) that differ from b[]. b == NULL:from blanks.
+ *  Stops counting at limit.
+ */
+static unsigned ansi_rowDiff(cons_cell_t const* a, cons_cell_t const* b, unsigned w, unsigned limit) {
+    unsigned i, n = 0;
+    if (!b) {
+        for (i = 0; i < w && n < limit; ++i)
+            n += (a[i] != CELL(' ', 0));
+        return n;
+    }
+    for (i = 0; i < w && n < limit; ++i)
+        n += (a[i] != b[i]);
+    return n;
+}
+
+/** Find rows of screen that are rows of shadow moved by k, and move them on
+ *  the terminal too. shadow is moved the same, and the rows in the scroll
+ *  region are marked dirty, so the diff repaints what the move did not fix.
+ *  @return 0:no move.
+ */
+static int ansi_scroll(cons_ansi_t* a, cons_cbuf_t* screen, cons_cbuf_t* shadow) {
+    unsigned    w = screen->w, h = screen->h, sz = w * sizeof(cons_cell_t);
+    unsigned    votes[ANSI_SCROLL_MAX * 2 + 1];
+    unsigned    y, y0, top, bot, m, d0, a0, a1, b0;
+    int         k, best, g, sum, gain;
+    cons_cell_t const* sc;
+    char*       d;
+    if (screen->dirty_y1 - screen->dirty_y0 < 2)
+        return 0;
+    // Vote for k by the changed rows that are much closer to the row k above.
+    // Not equal: the columns beside a moving area may not move.
+    memset(votes, 0, sizeof votes);
+    for (y = screen->dirty_y0; y < (unsigned)screen->dirty_y1; ++y) {
+        if (screen->dirty_x0[y] >= screen->dirty_x1[y])
+            continue;
+        sc = cons_cbufAt(screen, 0, y);
+        d0 = ansi_rowDiff(sc, cons_cbufAt(shadow, 0, y), w, w);
+        if (d0 < 2)
+            continue;
+        for (k = -ANSI_SCROLL_MAX; k <= ANSI_SCROLL_MAX; ++k) {
+            if (k && (int)y - k >= 0 && (int)y - k < (int)h
+                && ansi_rowDiff(sc, cons_cbufAt(shadow, 0, y - k), w, d0 / 2) < d0 / 2)
+                ++votes[k + ANSI_SCROLL_MAX];
+        }
+    }
+    best = 0;
+    for (k = -ANSI_SCROLL_MAX; k <= ANSI_SCROLL_MAX; ++k) {
+        if (votes[k + ANSI_SCROLL_MAX] > votes[best + ANSI_SCROLL_MAX])
+            best = k;
+    }
+    if (best == 0 || votes[best + ANSI_SCROLL_MAX] < 2)
+        return 0;
+    k = best;
+    m = (k > 0) ? k : -k;
+    // The run of rows [a0, a1] that saves the most cells when moved by k.
+    gain = sum = 0;
+    a0 = a1 = b0 = (k > 0) ? m : 0;
+    for (y = b0; y + (k < 0 ? m : 0) < h; ++y) {
+        sc   = cons_cbufAt(screen, 0, y);
+        g    = (int)ansi_rowDiff(sc, cons_cbufAt(shadow, 0, y), w, w)
+             - (int)ansi_rowDiff(sc, cons_cbufAt(shadow, 0, y - k), w, w);
+        if (sum <= 0) {
+            sum = 0;
+            b0  = y;
+        }
+        sum += g;
+        if (sum > gain) {
+            gain = sum;
+            a0   = b0;
+            a1   = y;
+        }
+    }
+    if (gain < ANSI_SCROLL_GAIN)
+        return 0;
+    // The rows left blank by the move.
+    top = (k > 0) ? a0 - m : a0;
+    bot = (k > 0) ? a1 : a1 + m;
+    y0  = (k > 0) ? top : a1 + 1;
+    for (y = y0; y < y0 + m; ++y) {
+        sc    = cons_cbufAt(screen, 0, y);
+        gain -= (int)ansi_rowDiff(sc, NULL, w, w) - (int)ansi_rowDiff(sc, cons_cbufAt(shadow, 0, y), w, w);
+    }
+    if (gain < ANSI_SCROLL_GAIN || !ansi_reserve(a, 40 + m * 2))
+        return 0;
+    d = a->buf + a->len;
+    if (a->col != 0) {      // New rows are filled with the background color.
+        memcpy(d, "\x1b[0m", 4);
+        d     += 4;
+        a->col = 0;
+    }
+    d += sprintf(d, "\x1b[%u;%ur\x1b[%u;1H", top + 1, bot + 1, (k > 0 ? top : bot) + 1);
+    for (y = 0; y < m; ++y) {
+        *d++ = '\x1b';
+        *d++ = (k > 0) ? 'M' : 'D';     // RI:down, IND:up.
+    }
+    memcpy(d, "\x1b[r", 3);             // Whole screen again. The cursor goes home.
+    a->len = (unsigned)(d + 3 - a->buf);
+    a->x   = 0;
+    a->y   = 0;
+    if (k > 0)
+        memmove(cons_cbufAt(shadow, 0, top + m), cons_cbufAt(shadow, 0, top), (bot + 1 - top - m) * sz);
+    else
+        memmove(cons_cbufAt(shadow, 0, top), cons_cbufAt(shadow, 0, top + m), (bot + 1 - top - m) * sz);
+    cons_cbufFill(shadow, 0, (cons_pos_t)y0, (cons_pos_t)w, (cons_pos_t)m, CELL(' ', 0));
+    for (y = top; y <= bot; ++y)
+        cons_cbufMarkDirty(screen, (cons_pos_t)y, 0, (cons_pos_t)w);
+    return 1;
+}
+
+/** SGR of color col. The same colors as the color pairs of cons_curses.c.
+ *  @return length.
+ */
+static unsigned ansi_sgrCol(char* d, cons_col_t col) {
+    static char const ansi[8] = { '0', '4', '1', '5', '2', '6', '3', '7' };   // cons -> ANSI color.
+    char c = ansi[col & 7];
+    if (col == 0) {
+        memcpy(d, "\x1b[0m", 4);
+        return 4;
+    }
+    memcpy(d, "\x1b[0;", 4);
+    if (col & CONS_COL_REVERSE) {   // Black on the color.
+        memcpy(d + 4, "30;", 3);
+        if (col & CONS_COL_LIGHT) {
+            memcpy(d + 7, "10", 2);
+            d[9]  = c;
+            d[10] = 'm';
+            return 11;
+        }
+        d[7] = '4';
+        d[8] = c;
+        d[9] = 'm';
+        return 10;
+    }
+    d[4] = (col & CONS_COL_LIGHT) ? '9' : '3';
+    d[5] = c;
+    memcpy(d + 6, ";40m", 4);
+    return 10;
+}
+
+/** ";38;..." of color c of cons_attr. Nothing for CONS_RGB_DEFAULT.
+ *  @param sel  3:foreground 4:background.
+ *  @return length.
+ */
+static unsigned ansi_sgrRgb(char* d, unsigned sel, unsigned long c) {
+    if (c == CONS_RGB_DEFAULT)
+        return 0;
+    if (c & CONS_RGB_PAL(0))
+        return (unsigned)sprintf(d, ";%u8;5;%u", sel, (unsigned)(c & 0xFF));
+    return (unsigned)sprintf(d, ";%u8;2;%u;%u;%u", sel,
+                             (unsigned)(c >> 16) & 0xFF, (unsigned)(c >> 8) & 0xFF, (unsigned)c & 0xFF);
+}
+
+/** SGR of color col to d[]. Made once, then copied.
+ *  @return length.
+ */
+static unsigned ansi_sgr(char* d, cons_col_t col) {
+    cons_attr_t const* at;
+    char*              s;
+    unsigned           n = s_sgrLen[col];
+    if (n == 0) {
+        s = s_sgr[col];
+        if (col < CONS_ATTR_FIRST) {
+            n = ansi_sgrCol(s, col);
+        } else {
+            at = _cons_PRIVATE_attrOf(col);
+            memcpy(s, "\x1b[0", 3);
+            n  = 3;
+            if (at->flags & CONS_ATTR_BOLD) {
+                memcpy(s + n, ";1", 2);
+                n += 2;
+            }
+            if (at->flags & CONS_ATTR_UNDERLINE) {
+                memcpy(s + n, ";4", 2);
+                n += 2;
+            }
+            n += ansi_sgrRgb(s + n, 3, at->fg);
+            n += ansi_sgrRgb(s + n, 4, at->bg);
+            s[n++] = 'm';
+        }
+        s_sgrLen[col] = (unsigned char)n;
+    }
+    memcpy(d, s_sgr[col], n);
+    return n;
+}
+
+/** Write the cells of the dirty spans of screen that differ from shadow.
+ */
+static void ansi_presentRows(cons_ansi_t* a, cons_cbuf_t* screen, cons_cbuf_t* shadow) {
+    cons_cell_t* cells;
+    cons_cell_t* sh;
+    cons_cell_t  c;
+    unsigned     y, i, n, x;
+    char*        d;
+    for (y = screen->dirty_y0; y < (unsigned)screen->dirty_y1; ++y) {
+        cells = cons_cbufAt(screen, 0, y);
+        sh    = cons_cbufAt(shadow, 0, y);
+        i     = screen->dirty_x0[y];
+        while ((n = cons_cbufDiff(cells, sh, screen->dirty_x1[y], &i)) != 0) {
+            x = i - n;
+            if (x > 0 && CELL_CP(cells[x]) == CELL_WIDE_R)  // Starts at a right half.
+                --x;
+            if (i < (unsigned)screen->w && CELL_CP(cells[i]) == CELL_WIDE_R) {
+                sh[i] = cells[i];
+                ++i;
+            }
+            // A cell needs ANSI_SGR_MAX bytes of SGR, 4 of UTF-8 and 12 of cursor move at most.
+            if (!ansi_reserve(a, (i - x) * (ANSI_SGR_MAX + 16)))
+                return;
+            d = a->buf + a->len;
+            for (; x < i; ++x) {
+                c = cells[x];
+                if (CELL_CP(c) == CELL_WIDE_R)
+                    continue;
+                if (a->y != (int)y || a->x != (int)x)
+                    d += sprintf(d, "\x1b[%u;%uH", y + 1, x + 1);
+                if (a->col != CELL_COL(c)) {
+                    a->col = CELL_COL(c);
+                    d += ansi_sgr(d, CELL_COL(c));
+                }
+                d   += _cons_PRIVATE_utf8(d, CELL_CP(c));
+                a->y = y;
+                a->x = x + ((x + 1 < (unsigned)screen->w && CELL_CP(cells[x + 1]) == CELL_WIDE_R) ? 2 : 1);
+                if (c & CELL_AMBI)      // The terminal may think it is narrow.
+                    a->x = -1;
+            }
+            a->len = (unsigned)(d - a->buf);
+        }
+    }
+}
+
+/** Write a frame: row moves, then the cells of the dirty spans of screen
+ *  that differ from shadow. The dirty spans are cleaned.
+ */
+void cons_ansiPresent(cons_ansi_t* a, cons_cbuf_t* screen, cons_cbuf_t* shadow) {
+    static char const bsu[] = "\x1b[?2026h";   // Begin and end of synchronized update.
+    static char const esu[] = "\x1b[?2026l";
+    unsigned          len   = a->len;
+    if (a->sync)
+        cons_ansiWrite(a, bsu, sizeof(bsu) - 1);
+    if (a->scroll)
+        ansi_scroll(a, screen, shadow);
+    ansi_presentRows(a, screen, shadow);
+    if (a->sync) {
+        if (a->len == len + sizeof(bsu) - 1)    // Nothing changed.
+            a->len = len;
+        else
+            cons_ansiWrite(a, esu, sizeof(esu) - 1);
+    }
+    cons_cbufClean(screen);
+}
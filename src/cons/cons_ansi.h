@@ -0,0 +1,42 @@
+/**
+ *  @file cons_ansi.h
+ *  @brief ANSI escape sequence output of cell buffers.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Private header of the backends that write to a terminal by themselves.
+ *   Cells are in the cons_text.h format. Output is UTF-8.
+ *   When rows of the screen moved up or down since the last frame, they are
+ *   moved on the terminal with a scroll region (DECSTBM and IND/RI) before
+ *   the changed cells are written. A frame is wrapped in synchronized output
+ *   (DEC mode 2026) when the terminal said it has it.
+ */
+#ifndef CONS_ANSI_H__
+#define CONS_ANSI_H__
+
+#define CONS_ANSI_SYNC_QUERY    "\x1b[?2026$p"    ///< DECRQM of mode 2026. The reply goes to cons_ansiSyncReply().
+
+/** Output to one terminal.
+ */
+typedef struct cons_ansi_t {
+    char*       buf;        ///< Bytes not sent yet.
+    unsigned    len;
+    unsigned    cap;
+    int         x;          ///< Cursor of the terminal. -1:unknown.
+    int         y;
+    int         col;        ///< Color of the terminal. -1:unknown.
+    int         err;        ///< Out of memory. Output was dropped.
+    char        sync;       ///< The terminal has synchronized output.
+    char        scroll;     ///< Row moves by scroll regions. On by cons_ansiInit().
+} cons_ansi_t;
+
+void cons_ansiInit(cons_ansi_t* a);
+void cons_ansiTerm(cons_ansi_t* a);
+void cons_ansiWrite(cons_ansi_t* a, char const* s, unsigned n);
+void cons_ansiConsume(cons_ansi_t* a, unsigned n);
+void cons_ansiReset(cons_ansi_t* a, cons_cbuf_t* shadow);
+int  cons_ansiSyncReply(cons_ansi_t* a, char const* csi, unsigned n);
+void cons_ansiPresent(cons_ansi_t* a, cons_cbuf_t* screen, cons_cbuf_t* shadow);
+
+#endif //CONS_ANSI_H__
@@ -0,0 +1,129 @@
+/**
+ *  @file cons_attr.c
+ *  @brief Extended attributes: 24 bit and 256 colors, bold and underline.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Colors are matched by the squared distance of r, g, b. The 16 colors
+ *   are taken as those of VGA: 0xAA on, 0x55 and 0xFF when light.
+ */
+#include "cons.h"
+
+#if defined(CONS_ATTR_EXT)
+cons_attr_t         _cons_PRIVATE_attr[CONS_ATTR_MAX];
+static unsigned     s_attrNum;
+#endif
+
+/** RGB of the 16 colors. i is a CONS_COL_ number: 1:blue 2:red 4:green 8:light.
+ */
+static unsigned long attr_rgb16(unsigned i) {
+    unsigned on  = (i & 8) ? 0xFF : 0xAA;
+    unsigned off = (i & 8) ? 0x55 : 0x00;
+    return CONS_RGB((i & 2) ? on : off, (i & 4) ? on : off, (i & 1) ? on : off);
+}
+
+/** RGB of c. CONS_RGB_DEFAULT is black.
+ */
+unsigned long _cons_PRIVATE_rgb(unsigned long c) {
+    static unsigned char const level[6] = { 0, 95, 135, 175, 215, 255 };
+    unsigned i;
+    if (c == CONS_RGB_DEFAULT)
+        return 0;
+    if (!(c & CONS_RGB_PAL(0)))
+        return c;
+    i = (unsigned)(c & 0xFF);
+    if (i < 16)     // ANSI order. 1:red 2:green 4:blue.
+        return attr_rgb16((i & 8) | ((i & 1) << 1) | ((i & 2) << 1) | ((i & 4) >> 2));
+    if (i >= 232)
+        return CONS_RGB(8 + (i - 232) * 10, 8 + (i - 232) * 10, 8 + (i - 232) * 10);
+    i -= 16;
+    return CONS_RGB(level[i / 36], level[i / 6 % 6], level[i % 6]);
+}
+
+static unsigned long attr_dist(unsigned long a, unsigned long b) {
+    long r = (long)((a >> 16) & 0xFF) - (long)((b >> 16) & 0xFF);
+    long g = (long)((a >>  8) & 0xFF) - (long)((b >>  8) & 0xFF);
+    long l = (long)( a        & 0xFF) - (long)( b        & 0xFF);
+    return (unsigned long)(r * r + g * g + l * l);
+}
+
+/** Color of the xterm 256 color palette nearest to c.
+ */
+unsigned _cons_PRIVATE_rgbTo256(unsigned long c) {
+    unsigned long rgb;
+    unsigned      r, g, b, i, cube, gray;
+    if (c & CONS_RGB_PAL(0))
+        return (unsigned)(c & 0xFF);
+    rgb  = _cons_PRIVATE_rgb(c);
+    r    = (unsigned)(rgb >> 16) & 0xFF;
+    g    = (unsigned)(rgb >>  8) & 0xFF;
+    b    = (unsigned) rgb        & 0xFF;
+    r    = (r < 48) ? 0 : (r < 115) ? 1 : (r - 35) / 40;
+    g    = (g < 48) ? 0 : (g < 115) ? 1 : (g - 35) / 40;
+    b    = (b < 48) ? 0 : (b < 115) ? 1 : (b - 35) / 40;
+    cube = 16 + r * 36 + g * 6 + b;
+    i    = (unsigned)((((rgb >> 16) & 0xFF) + ((rgb >> 8) & 0xFF) + (rgb & 0xFF)) / 3);
+    gray = 232 + ((i < 8) ? 0 : (i > 238) ? 23 : (i - 8) / 10);
+    return (attr_dist(rgb, _cons_PRIVATE_rgb(CONS_RGB_PAL(gray)))
+            < attr_dist(rgb, _cons_PRIVATE_rgb(CONS_RGB_PAL(cube)))) ? gray : cube;
+}
+
+/** The nearest of the 16 colors. A CONS_COL_ number.
+ */
+static unsigned attr_nearest16(unsigned long c) {
+    unsigned long rgb = _cons_PRIVATE_rgb(c), d, best_d = ~0UL;
+    unsigned      i, best = 0;
+    for (i = 0; i < 16; ++i) {
+        d = attr_dist(rgb, attr_rgb16(i));
+        if (d < best_d) {
+            best_d = d;
+            best   = i;
+        }
+    }
+    return best;
+}
+
+/** The nearest CONS_COL_ value of the backend.
+ *  A background other than black makes it CONS_COL_REVERSE: black on the background.
+ */
+static cons_col_t attr_nearest(unsigned long fg, unsigned long bg) {
+    unsigned i;
+    if (bg != CONS_RGB_DEFAULT && (i = attr_nearest16(bg)) != 0)
+        return (cons_col_t)(CONS_COL_REVERSE | (i & 7) | ((i & 8) ? CONS_COL_BACK_LIGHT : 0));
+    if (fg == CONS_RGB_DEFAULT)
+        return CONS_COL_DEFAULT;
+    i = attr_nearest16(fg);
+    if (i == 0)
+        return CONS_COL_BLACK;
+    return (cons_col_t)((i & 7) | ((i & 8) ? CONS_COL_LIGHT : 0));
+}
+
+/** Register an attribute.
+ *  @param fg,bg    CONS_RGB(r,g,b), CONS_RGB_PAL(i) or CONS_RGB_DEFAULT.
+ *  @param flags    CONS_ATTR_BOLD, CONS_ATTR_UNDERLINE.
+ *  @return color for cons_xycputs() and so on. The same attribute gets the same color.
+ */
+cons_col_t cons_attrMake(unsigned long fg, unsigned long bg, unsigned flags) {
+    cons_col_t   nearest = attr_nearest(fg, bg);
+ #if defined(CONS_ATTR_EXT)
+    cons_attr_t* a;
+    unsigned     i;
+    for (i = 0; i < s_attrNum; ++i) {
+        a = &_cons_PRIVATE_attr[i];
+        if (a->fg == fg && a->bg == bg && a->flags == flags)
+            return (cons_col_t)(CONS_ATTR_FIRST + i);
+    }
+    if (s_attrNum >= CONS_ATTR_MAX)
+        return nearest;
+    a          = &_cons_PRIVATE_attr[s_attrNum];
+    a->fg      = fg;
+    a->bg      = bg;
+    a->flags   = (unsigned char)flags;
+    a->nearest = nearest;
+    return (cons_col_t)(CONS_ATTR_FIRST + s_attrNum++);
+ #else
+    (void)flags;
+    return nearest;
+ #endif
+}
@@ -0,0 +1,56 @@
+/**
+ *  @file cons_attr.h
+ *  @brief Extended attributes: 24 bit and 256 colors, bold and underline.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Included from the backend header after cons_cell.h.
+ *   cons_attrMake() registers an attribute once and returns a cons_col_t for
+ *   it, used like the CONS_COL_ values. Cells do not grow, and nothing is
+ *   looked up per cell: the server keeps the SGR string of each cons_col_t,
+ *   and curses the color pair.
+ *   Colors below CONS_ATTR_FIRST are the CONS_COL_ values. When the registry
+ *   is full, the nearest CONS_COL_ value is returned.
+ *   The DOS backends have no room in their cells. cons_attrMake() returns the
+ *   nearest color of their palette there.
+ *   Register at init, not in every frame.
+ */
+#ifndef CONS_ATTR_H__
+#define CONS_ATTR_H__
+
+#if (defined(CONS_CURSES) || defined(CONS_SERVER)) && !defined(__DOS__)
+#define CONS_ATTR_EXT                       ///< Registered attributes are kept as they are.
+#endif
+
+#define CONS_RGB(r,g,b)         (((unsigned long)(r) << 16) | ((unsigned)(g) << 8) | (b))
+#define CONS_RGB_PAL(i)         (0x1000000UL | (i))     ///< Color i of the xterm 256 color palette.
+#define CONS_RGB_DEFAULT        0x2000000UL             ///< The color of the terminal.
+
+#define CONS_ATTR_BOLD          0x01
+#define CONS_ATTR_UNDERLINE     0x02
+
+#define CONS_ATTR_FIRST         32                      ///< First cons_col_t of the registry.
+#define CONS_ATTR_MAX           (256 - CONS_ATTR_FIRST) ///< Number of attributes.
+
+/** A registered attribute.
+ */
+typedef struct cons_attr_t {
+    unsigned long   fg;         ///< CONS_RGB(), CONS_RGB_PAL() or CONS_RGB_DEFAULT.
+    unsigned long   bg;
+    unsigned char   flags;      ///< CONS_ATTR_BOLD, CONS_ATTR_UNDERLINE.
+    cons_col_t      nearest;    ///< The nearest CONS_COL_ value.
+} cons_attr_t;
+
+cons_col_t cons_attrMake(unsigned long fg, unsigned long bg, unsigned flags);
+
+#if 1 // private name.
+  #if defined(CONS_ATTR_EXT)
+    extern cons_attr_t  _cons_PRIVATE_attr[CONS_ATTR_MAX];
+    #define _cons_PRIVATE_attrOf(col)   (&_cons_PRIVATE_attr[(col) - CONS_ATTR_FIRST])
+  #endif
+    unsigned long _cons_PRIVATE_rgb(unsigned long c);
+    unsigned _cons_PRIVATE_rgbTo256(unsigned long c);
+#endif
+
+#endif //CONS_ATTR_H__
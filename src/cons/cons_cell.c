@@ -0,0 +1,280 @@
+/**
+ *  @file cons_cell.c
+ *  @brief Cell buffers shared by all cons backends.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ */
+#include "cons.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(CONS_CELL_USE_FAR)
+#include <malloc.h>
+#define cell_malloc(n)          _fmalloc(n)
+#define cell_free(p)            _ffree(p)
+#define cell_memmove(d,s,n)     _fmemmove((d), (s), (n))
+#else
+#define cell_malloc(n)          malloc(n)
+#define cell_free(p)            free(p)
+#define cell_memmove(d,s,n)     memmove((d), (s), (n))
+#endif
+
+#if defined(CONS_CELL_PLANES)
+#define CELL_BYTES              (2 * sizeof(cons_plane_t))
+#else
+#define CELL_BYTES              sizeof(cons_cell_t)
+#endif
+
+/** Copy n cells from index si of s to index di of d. Overlap safe.
+ */
+static void cbuf_copy(cons_cbuf_t* d, unsigned di, cons_cbuf_t const* s, unsigned si, unsigned n) {
+    cell_memmove(&d->cells[di], &s->cells[si], n * sizeof(d->cells[0]));
+ #if defined(CONS_CELL_PLANES)
+    cell_memmove(&d->attrs[di], &s->attrs[si], n * sizeof(d->attrs[0]));
+ #endif
+}
+
+/** Clip the rect (*x, *y, *w, *h) to the buffer.
+ *  @param ox,oy    amounts cut off at the left and the top.
+ *  @return 0:nothing left.
+ */
+static int cbuf_clip(cons_cbuf_t const* b, int* x, int* y, int* w, int* h, int* ox, int* oy) {
+    *ox = *oy = 0;
+    if (*x < 0) { *ox = -*x; *w += *x; *x = 0; }
+    if (*y < 0) { *oy = -*y; *h += *y; *y = 0; }
+    if (*x + *w > b->w) *w = b->w - *x;
+    if (*y + *h > b->h) *h = b->h - *y;
+    return *w > 0 && *h > 0;
+}
+
+/** Initialize a w x h buffer. The contents of the cells are undefined.
+ *  @param cells    memory for w * h cells, or NULL to allocate it.
+ *                  With CONS_CELL_PLANES, the w * h words of cells[] then the w * h words of attrs[].
+ *  @return 0:out of memory.
+ */
+int cons_cbufInit(cons_cbuf_t* b, cons_pos_t w, cons_pos_t h, void CONS_CELL_FAR* cells) {
+    memset(b, 0, sizeof(*b));
+    if (w <= 0 || h <= 0)
+        return 0;
+    b->dirty_x0 = (cons_pos_t*)calloc(2 * h, sizeof(cons_pos_t));
+    if (!b->dirty_x0)
+        return 0;
+    b->dirty_x1 = b->dirty_x0 + h;
+    if (!cells) {
+        cells = cell_malloc((size_t)w * h * CELL_BYTES);
+        if (!cells) {
+            free(b->dirty_x0);
+            b->dirty_x0 = b->dirty_x1 = NULL;
+            return 0;
+        }
+        b->own = 1;
+    }
+    b->cells    = cells;
+ #if defined(CONS_CELL_PLANES)
+    b->attrs    = b->cells + (unsigned)w * h;
+ #endif
+    b->w        = w;
+    b->h        = h;
+    b->dirty_y0 = h;
+    b->dirty_y1 = 0;
+    return 1;
+}
+
+/** Release the buffer.
+ */
+void cons_cbufTerm(cons_cbuf_t* b) {
+    if (b->own && b->cells)
+        cell_free(b->cells);
+    free(b->dirty_x0);
+    memset(b, 0, sizeof(*b));
+}
+
+/** Mark columns [x0, x1) of row y dirty. Not counted as written cells; the writers count them.
+ */
+void cons_cbufMarkDirty(cons_cbuf_t* b, cons_pos_t y, cons_pos_t x0, cons_pos_t x1) {
+    if (y < 0 || y >= b->h)
+        return;
+    if (x0 < 0)
+        x0 = 0;
+    if (x1 > b->w)
+        x1 = b->w;
+    if (x0 >= x1)
+        return;
+    if (b->dirty_x0[y] >= b->dirty_x1[y]) {
+        b->dirty_x0[y] = x0;
+        b->dirty_x1[y] = x1;
+    } else {
+        if (b->dirty_x0[y] > x0) b->dirty_x0[y] = x0;
+        if (b->dirty_x1[y] < x1) b->dirty_x1[y] = x1;
+    }
+    if (b->dirty_y0 > y)     b->dirty_y0 = y;
+    if (b->dirty_y1 < y + 1) b->dirty_y1 = y + 1;
+}
+
+/** Mark the whole buffer dirty.
+ */
+void cons_cbufMarkAll(cons_cbuf_t* b) {
+    cons_pos_t y;
+    for (y = 0; y < b->h; ++y) {
+        b->dirty_x0[y] = 0;
+        b->dirty_x1[y] = b->w;
+    }
+    b->dirty_y0  = 0;
+    b->dirty_y1  = b->h;
+    b->dirty_all = 1;
+}
+
+/** Mark the whole buffer clean. Called by the backend after presenting.
+ */
+void cons_cbufClean(cons_cbuf_t* b) {
+    cons_pos_t y;
+    for (y = b->dirty_y0; y < b->dirty_y1; ++y)
+        b->dirty_x0[y] = b->dirty_x1[y] = 0;
+    b->dirty_y0  = b->h;
+    b->dirty_y1  = 0;
+    b->dirty_all = 0;
+}
+
+/** Fill a rect with cell c.
+ */
+void cons_cbufFill(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h, cons_cell_t c) {
+    unsigned o;
+    int cx = x, cy = y, cw = w, ch = h, ox, oy, i, j;
+    if (!cbuf_clip(b, &cx, &cy, &cw, &ch, &ox, &oy))
+        return;
+    for (j = 0; j < ch; ++j) {
+        o = cons_cbufIndex(b, cx, cy + j);
+        for (i = 0; i < cw; ++i)
+            cons_cbufSetCell(b, o + i, c);
+        cons_cbufMarkDirty(b, cy + j, cx, cx + cw);
+    }
+    _cons_PRIVATE_statsAdd(cells_put, (unsigned long)cw * ch);
+    if (cw == b->w && ch == b->h)
+        b->dirty_all = 1;
+}
+
+/** Put a w x h array of cells at (x, y).
+ */
+void cons_cbufPut(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h, cons_cell_t const* src) {
+    int cx = x, cy = y, cw = w, ch = h, ox, oy, j;
+ #if defined(CONS_CELL_PLANES)
+    unsigned o;
+    int      i;
+ #endif
+    if (!cbuf_clip(b, &cx, &cy, &cw, &ch, &ox, &oy))
+        return;
+    src += oy * w + ox;
+    for (j = 0; j < ch; ++j) {
+     #if defined(CONS_CELL_PLANES)
+        o = cons_cbufIndex(b, cx, cy + j);
+        for (i = 0; i < cw; ++i)
+            cons_cbufSetCell(b, o + i, src[i]);
+     #else
+        cell_memmove(cons_cbufAt(b, cx, cy + j), src, cw * sizeof(cons_cell_t));
+     #endif
+        cons_cbufMarkDirty(b, cy + j, cx, cx + cw);
+        src += w;
+    }
+    _cons_PRIVATE_statsAdd(cells_put, (unsigned long)cw * ch);
+}
+
+/** Put src[0 .. n) at (x, y) with bits ORed to each cell. One row, no wrap.
+ */
+void cons_cbufPutRow(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_cell_t const* src, unsigned n, cons_cell_t bits) {
+    cons_cell_t c;
+    unsigned    o;
+    int i = 0, e = n;
+    if (y < 0 || y >= b->h)
+        return;
+    if (x < 0)
+        i = -x;
+    if (x + e > b->w)
+        e = b->w - x;
+    if (i >= e)
+        return;
+    _cons_PRIVATE_statsAdd(cells_put, e - i);
+    o = cons_cbufIndex(b, x, y);
+    for (; i < e; ++i) {
+        c = src[i] | bits;
+        cons_cbufSetCell(b, o + i, c);
+    }
+    cons_cbufMarkDirty(b, y, x, x + e);
+}
+
+/** Read back a w x h rect at (x, y) to dst[]. Cells out of the buffer are not written.
+ */
+void cons_cbufGet(cons_cbuf_t const* b, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h, cons_cell_t* dst) {
+    int cx = x, cy = y, cw = w, ch = h, ox, oy, j;
+ #if defined(CONS_CELL_PLANES)
+    unsigned o;
+    int      i;
+ #endif
+    if (!cbuf_clip(b, &cx, &cy, &cw, &ch, &ox, &oy))
+        return;
+    dst += oy * w + ox;
+    for (j = 0; j < ch; ++j) {
+     #if defined(CONS_CELL_PLANES)
+        o = cons_cbufIndex(b, cx, cy + j);
+        for (i = 0; i < cw; ++i)
+            dst[i] = cons_cbufCell(b, o + i);
+     #else
+        cell_memmove(dst, cons_cbufAt(b, cx, cy + j), cw * sizeof(cons_cell_t));
+     #endif
+        dst += w;
+    }
+}
+
+/** Copy the w x h rect at (sx, sy) of src to (dx, dy) of dst.
+ *  src and dst may be the same buffer.
+ */
+void cons_cbufBlit(cons_cbuf_t* dst, cons_pos_t dx, cons_pos_t dy,
+                   cons_cbuf_t const* src, cons_pos_t sx, cons_pos_t sy, cons_pos_t w, cons_pos_t h)
+{
+    int x = sx, y = sy, cw = w, ch = h, ox, oy, j, step;
+    if (!cbuf_clip(src, &x, &y, &cw, &ch, &ox, &oy))
+        return;
+    sx  = x;
+    sy  = y;
+    x   = dx + ox;
+    y   = dy + oy;
+    if (!cbuf_clip(dst, &x, &y, &cw, &ch, &ox, &oy))
+        return;
+    sx += ox;
+    sy += oy;
+    j    = 0;
+    step = 1;
+    if (src == dst && y > sy) { // Overlapped. Copy from the bottom.
+        j    = ch - 1;
+        step = -1;
+    }
+    for (; j >= 0 && j < ch; j += step) {
+        cbuf_copy(dst, cons_cbufIndex(dst, x, y + j), src, cons_cbufIndex(src, sx, sy + j), cw);
+        cons_cbufMarkDirty(dst, y + j, x, x + cw);
+    }
+    _cons_PRIVATE_statsAdd(cells_put, (unsigned long)cw * ch);
+}
+
+/** Find the next run of src[*pos .. end) that differs from shadow[],
+ *  and copy it to shadow[]. For whole cells; a backend with CONS_CELL_PLANES diffs each plane.
+ *  @return length of the run. 0 when there is no more.
+ *          *pos is set to the end of the run.
+ */
+unsigned cons_cbufDiff(cons_cell_t CONS_CELL_FAR const* src, cons_cell_t CONS_CELL_FAR* shadow,
+                       unsigned end, unsigned* pos)
+{
+    unsigned i = *pos, j;
+    while (i < end && src[i] == shadow[i])
+        ++i;
+    if (i >= end) {
+        *pos = end;
+        return 0;
+    }
+    j = i;
+    do {
+        shadow[j] = src[j];
+    } while (++j < end && src[j] != shadow[j]);
+    *pos = j;
+    _cons_PRIVATE_statsAdd(cells_changed, j - i);
+    return j - i;
+}
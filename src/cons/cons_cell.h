@@ -0,0 +1,81 @@
+/**
+ *  @file cons_cell.h
+ *  @brief Cell buffers shared by all cons backends.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Included from the backend header after cons_cell_t is defined.
+ *   The screen of every backend is a cons_cbuf_t. Drawing only writes cells
+ *   and marks dirty spans; the backend presents the dirty spans at
+ *   cons_updateEnd().
+ *   A cons_cell_t is an integer in the backend's own format, so cells can be
+ *   compared with == and copied as is. Make them with cons_makeCell().
+ *   With CONS_CELL_PLANES (PC-98) the buffer keeps a cell as two words in two
+ *   planes, cells[] for the low word and attrs[] for the high word, which are
+ *   the layouts of the text and attribute VRAM. Code shared by all backends
+ *   reads and writes cells with cons_cbufCell() and cons_cbufSetCell().
+ */
+#ifndef CONS_CELL_H__
+#define CONS_CELL_H__
+
+#if (defined(__I86__) || defined(__ia16__)) && !defined(__FLAT__)
+#define CONS_CELL_FAR           __far       ///< 16bit DOS. Cells may be out of DGROUP.
+#define CONS_CELL_USE_FAR
+#else
+#define CONS_CELL_FAR
+#endif
+
+#if defined(CONS_CELL_PLANES)
+typedef unsigned short          cons_plane_t;   ///< One word of a cell in a plane.
+#endif
+
+/** Cell buffer.
+ */
+typedef struct cons_cbuf_t {
+ #if defined(CONS_CELL_PLANES)
+    cons_plane_t CONS_CELL_FAR* cells;      ///< w * h low words. Row major.
+    cons_plane_t CONS_CELL_FAR* attrs;      ///< w * h high words. Follows cells[] in the same memory.
+ #else
+    cons_cell_t CONS_CELL_FAR*  cells;      ///< w * h cells. Row major.
+ #endif
+    cons_pos_t                  w;
+    cons_pos_t                  h;
+    cons_pos_t                  dirty_y0;   ///< First dirty row.
+    cons_pos_t                  dirty_y1;   ///< Last dirty row + 1.
+    cons_pos_t*                 dirty_x0;   ///< Dirty span [x0, x1) of each row.
+    cons_pos_t*                 dirty_x1;   ///< Clean when x0 >= x1.
+    unsigned char               dirty_all;  ///< Whole buffer is dirty.
+    unsigned char               own;        ///< cells were allocated by cons_cbufInit.
+} cons_cbuf_t;
+
+#define cons_cbufIndex(b,x,y)   ((unsigned)(y) * (b)->w + (x))
+#define cons_cbufAt(b,x,y)      (&(b)->cells[cons_cbufIndex(b,x,y)])   ///< Not a whole cell with CONS_CELL_PLANES.
+#if defined(CONS_CELL_PLANES)
+#define cons_cbufCell(b,i)      (((cons_cell_t)(b)->attrs[i] << 16) | (b)->cells[i])
+#define cons_cbufSetCell(b,i,c) ((b)->cells[i] = (cons_plane_t)(c), (b)->attrs[i] = (cons_plane_t)((c) >> 16))
+#else
+#define cons_cbufCell(b,i)      ((b)->cells[i])
+#define cons_cbufSetCell(b,i,c) ((b)->cells[i] = (c))
+#endif
+
+int  cons_cbufInit(cons_cbuf_t* b, cons_pos_t w, cons_pos_t h, void CONS_CELL_FAR* cells);
+void cons_cbufTerm(cons_cbuf_t* b);
+void cons_cbufFill(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h, cons_cell_t c);
+void cons_cbufPut(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h, cons_cell_t const* src);
+void cons_cbufPutRow(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_cell_t const* src, unsigned n, cons_cell_t bits);
+void cons_cbufGet(cons_cbuf_t const* b, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h, cons_cell_t* dst);
+void cons_cbufBlit(cons_cbuf_t* dst, cons_pos_t dx, cons_pos_t dy,
+                   cons_cbuf_t const* src, cons_pos_t sx, cons_pos_t sy, cons_pos_t w, cons_pos_t h);
+void cons_cbufMarkDirty(cons_cbuf_t* b, cons_pos_t y, cons_pos_t x0, cons_pos_t x1);
+void cons_cbufMarkAll(cons_cbuf_t* b);
+void cons_cbufClean(cons_cbuf_t* b);
+unsigned cons_cbufDiff(cons_cell_t CONS_CELL_FAR const* src, cons_cell_t CONS_CELL_FAR* shadow,
+                       unsigned end, unsigned* pos);
+
+// Implemented by the backend.
+cons_cbuf_t* cons_screen(void);
+cons_cell_t  cons_makeCell(unsigned ch, cons_col_t col);
+unsigned     cons_encodeCells(cons_cell_t* d, char const* str, unsigned max);
+
+#endif //CONS_CELL_H__
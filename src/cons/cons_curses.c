@@ -6,6 +6,9 @@
  *  @license Boost Software License - Version 1.0
  */
 
+#if !defined(_WIN32) && !defined(__DOS__) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE   700     // Wide character API of ncurses.
+#endif
 #include "cons_curses.h"
 #include <string.h>
 #include <stdio.h>
@@ -25,6 +28,51 @@
 #include <locale.h>
 #endif
 
+#include "cons_text.h"
+#if defined(CELL_UTF8) && (defined(PDC_WIDE) || (defined(NCURSES_WIDECHAR) && NCURSES_WIDECHAR))
+#define CELL_USE_WCHAR              // Runs are written with addnwstr().
+#endif
+
+#if defined(CONS_USE_PDCURSES)
+#define _cons_outFd()       (-1)            // No output queue to look at.
+#else
+#define _cons_outFd()       fileno(stdout)  // The terminal of ncurses.
+#endif
+
+static cons_text_t  s_text;
+static cons_cbuf_t  s_shadow;           ///< What curses has been given.
+static cons_pace_t  s_pace;
+
+#define CONS_CURSES_PAIRS   255             ///< Color pairs used at most. COLOR_PAIR() holds 8 bits.
+
+/** Colors of a cons_col_t, and its pair.
+ */
+typedef struct cons_colPair_t {
+    int             fg;                 ///< curses colors.
+    int             bg;
+    attr_t          attr;               ///< A_BOLD, A_UNDERLINE.
+    unsigned char   pair;               ///< 0:no pair now.
+    unsigned char   made;               ///< fg, bg and attr are set.
+    unsigned char   lent;               ///< pair is of another color. No pair was free.
+} cons_colPair_t;
+
+/** A color pair of curses.
+ */
+typedef struct cons_pair_t {
+    int             fg;
+    int             bg;
+    unsigned long   used;               ///< s_pairClock of the last use. 0:free.
+} cons_pair_t;
+
+static cons_colPair_t   s_colPair[256];
+static cons_pair_t      s_pair[CONS_CURSES_PAIRS + 1];  ///< 1 ..s_pairMax. Pair 0 is the default colors.
+static unsigned         s_pairMax;
+static unsigned long    s_pairClock;
+static int              s_pairFull;     ///< Every pair was on the screen in this frame.
+#if !defined(CONS_USE_PDCURSES)
+static char const*  s_sync;             ///< Sync of terminfo. Synchronized output (DEC mode 2026).
+#endif
+
 static cons_pos_t   _cons_screen_width;
 static cons_pos_t   _cons_screen_height;
 static cons_clock_t _cons_start_clock;
@@ -47,6 +95,20 @@ static cons_clock_t _con_getCurrentTimer() {
  #endif
 }
 
+/** Micro seconds for cons_stats.
+ */
+unsigned long _cons_PRIVATE_statsUsec(void) {
+ #if defined __DJGPP__
+    return (unsigned long)(uclock() * 1000000 / UCLOCKS_PER_SEC);
+ #elif defined(__DOS__) || defined(_WIN32)
+    return (unsigned long)clock() * (1000000UL / CLOCKS_PER_SEC);
+ #else
+    struct timeval tv = {0,0};
+    gettimeofday(&tv, NULL);
+    return (unsigned long)tv.tv_sec * 1000000UL + (unsigned long)tv.tv_usec;
+ #endif
+}
+
 static void _cons_updateScreenSize(void) {
     int w = 80, h = 24;
     getmaxyx(stdscr, h, w);
@@ -58,8 +120,280 @@ static void _cons_updateScreenSize(void) {
     _cons_screen_height = h;
 }
 
+/** Reallocate the buffers to the screen size. Keep what fits.
+ */
+static void _cons_resizeBuffers(void) {
+    cons_pos_t  w   = _cons_screen_width;
+    cons_pos_t  h   = _cons_screen_height;
+    cons_cbufTerm(&s_shadow);
+    if (!_cons_PRIVATE_textResize(&s_text, w, h))
+        return;
+    if (!cons_cbufInit(&s_shadow, w, h, NULL)) {
+        cons_cbufTerm(&s_text.screen);
+        return;
+    }
+    cons_cbufFill(&s_shadow, 0, 0, w, h, CELL_INVALID);
+    clear();    // Repaint everything at the next refresh.
+}
+
+#if defined(CELL_USE_WCHAR)
+typedef wchar_t     cons_tchar_t;
+#define _cons_addText(b,n)  addnwstr((b), (n))
+
+/** Code point cp to d[].
+ *  @return 1.
+ */
+static unsigned _cons_encode(wchar_t* d, unsigned long cp) {
+    if ((cp & ~0xFFUL) == CELL_RAW || (sizeof(wchar_t) < 4 && cp > 0xFFFF))
+        cp = 0xFFFD;
+    d[0] = (wchar_t)cp;
+    return 1;
+}
+#else
+typedef char        cons_tchar_t;
+#define _cons_addText(b,n)  addnstr((b), (n))
+#define _cons_encode(d,cp)  _cons_PRIVATE_utf8((d), (cp))
+#endif
+
+/** curses colors of the CONS_COL_ numbers 0..7. */
+static short const  s_cursesCol[8] = { COLOR_BLACK, COLOR_BLUE, COLOR_RED, COLOR_MAGENTA,
+                                       COLOR_GREEN, COLOR_CYAN, COLOR_YELLOW, COLOR_WHITE };
+
+/** curses color of CONS_COL_ number i (0..15).
+ *  Light colors are the dark ones and *a gets A_BOLD, when the terminal has 8 colors.
+ */
+static int _cons_cursesCol(unsigned i, attr_t* a) {
+    if ((i & 8) && COLORS < 16) {
+        if (a)
+            *a |= A_BOLD;
+        i &= 7;
+    }
+    return s_cursesCol[i & 7] | (i & 8);
+}
+
+/** The pair of color col: curses colors and attributes. Worked out once per col.
+ */
+static cons_colPair_t* _cons_colPair(cons_col_t col) {
+    cons_colPair_t* c = &s_colPair[col];
+    unsigned        i = col & 15;
+ #if defined(CONS_ATTR_EXT)
+    cons_attr_t const* at;
+ #endif
+    if (c->made)
+        return c;
+    c->made = 1;
+ #if defined(CONS_ATTR_EXT)
+    if (col >= CONS_ATTR_FIRST) {
+        at = _cons_PRIVATE_attrOf(col);
+        if (COLORS >= 256) {
+         #if defined(NCURSES_EXT_COLORS)
+            if (COLORS >= 0x1000000) {      // Direct color. (e.g. TERM=xterm-direct)
+                c->fg = (at->fg == CONS_RGB_DEFAULT) ? COLOR_WHITE : (int)_cons_PRIVATE_rgb(at->fg);
+                c->bg = (at->bg == CONS_RGB_DEFAULT) ? COLOR_BLACK : (int)_cons_PRIVATE_rgb(at->bg);
+            } else
+         #endif
+            {
+                c->fg = (at->fg == CONS_RGB_DEFAULT) ? COLOR_WHITE : (int)_cons_PRIVATE_rgbTo256(at->fg);
+                c->bg = (at->bg == CONS_RGB_DEFAULT) ? COLOR_BLACK : (int)_cons_PRIVATE_rgbTo256(at->bg);
+            }
+        } else {
+            *c = *_cons_colPair(at->nearest);
+            c->pair = 0;
+        }
+        if (at->flags & CONS_ATTR_BOLD)
+            c->attr |= A_BOLD;
+        if (at->flags & CONS_ATTR_UNDERLINE)
+            c->attr |= A_UNDERLINE;
+        return c;
+    }
+ #endif
+    if (col & CONS_COL_REVERSE) {       // Black on the color.
+        c->fg = COLOR_BLACK;
+        c->bg = _cons_cursesCol(i, NULL);
+    } else {
+        c->fg = _cons_cursesCol(i, &c->attr);
+        c->bg = COLOR_BLACK;
+    }
+    return c;
+}
+
+/** Pair p is given to other colors. The colors that had it have none now.
+ */
+static void _cons_pairFree(unsigned p) {
+    unsigned i;
+    for (i = 0; i < 256; ++i) {
+        if (s_colPair[i].pair == p || (s_colPair[i].lent && s_colPair[i].pair == 0)) {
+            s_colPair[i].pair = 0;
+            s_colPair[i].lent = 0;
+        }
+    }
+}
+
+/** The least recently used pair with no cell on the screen. 0:every pair is on the screen.
+ *  init_pair() of a pair on the screen would change the colors of its cells.
+ */
+static unsigned _cons_pairUnseen(void) {
+    unsigned char               seen[CONS_CURSES_PAIRS + 1];
+    cons_cell_t CONS_CELL_FAR*  sh = s_shadow.cells;
+    unsigned                    i, n, p = 0;
+    memset(seen, 0, sizeof seen);
+    n = sh ? (unsigned)s_shadow.w * s_shadow.h : 0;
+    for (i = 0; i < n; ++i) {
+        if (sh[i] != CELL_INVALID)
+            seen[s_colPair[CELL_COL(sh[i])].pair] = 1;
+    }
+    for (i = 1; i <= s_pairMax; ++i) {
+        if (!seen[i] && (p == 0 || s_pair[i].used < s_pair[p].used))
+            p = i;
+    }
+    return p;
+}
+
+/** A pair for the colors of col. An equal pair is shared; else a free one, or
+ *  the least recently used one off the screen, is set by init_pair().
+ *  When all are on the screen, the pair of the nearest CONS_COL_ value is lent.
+ */
+static unsigned _cons_pairGet(cons_col_t col, cons_colPair_t* c) {
+    unsigned p, lru = 0;
+    for (p = 1; p <= s_pairMax; ++p) {
+        if (s_pair[p].used && s_pair[p].fg == c->fg && s_pair[p].bg == c->bg) {
+            _cons_PRIVATE_statsAdd(pair_hits, 1);
+            return p;
+        }
+        if (!s_pair[p].used && !lru)
+            lru = p;
+    }
+    _cons_PRIVATE_statsAdd(pair_misses, 1);
+    if (!lru && !s_pairFull) {
+        lru = _cons_pairUnseen();
+        s_pairFull = (lru == 0);
+        if (lru)
+            _cons_pairFree(lru);
+    }
+    if (!lru) {
+        c->lent = 1;
+     #if defined(CONS_ATTR_EXT)
+        if (col >= CONS_ATTR_FIRST)
+            return _cons_colPair(_cons_PRIVATE_attrOf(col)->nearest)->pair;
+     #else
+        (void)col;
+     #endif
+        return 0;
+    }
+    s_pair[lru].fg = c->fg;
+    s_pair[lru].bg = c->bg;
+ #if defined(NCURSES_EXT_COLORS)
+    init_extended_pair((int)lru, c->fg, c->bg);
+ #else
+    init_pair((short)lru, (short)c->fg, (short)c->bg);
+ #endif
+    return lru;
+}
+
+/** attrset() of color col. The pair is made on first use.
+ */
+static void _cons_attrset(cons_col_t col) {
+    cons_colPair_t* c = _cons_colPair(col);
+    unsigned        p = c->pair;
+    if (col == CONS_COL_DEFAULT || s_pairMax == 0) {
+        attrset(c->attr);
+        return;
+    }
+    if (p || c->lent) {
+        _cons_PRIVATE_statsAdd(pair_hits, 1);
+    } else {
+        p       = _cons_pairGet(col, c);
+        c->pair = (unsigned char)p;
+    }
+    if (p)
+        s_pair[p].used = ++s_pairClock;
+    attrset(COLOR_PAIR(p) | c->attr);
+}
+
+/** Write n cells from (x, y) to curses.
+ *  The cells are measured already, so curses only gets runs of text.
+ *  After an ambiguous character drawn as wide, the cursor is moved to
+ *  our column, whatever width curses thinks it has.
+ */
+static void _cons_emitRun(int y, int x, cons_cell_t CONS_CELL_FAR const* c, unsigned n) {
+    cons_tchar_t buf[256];
+    unsigned    len = 0, i;
+    int         brk = 0;
+    cons_col_t  col = CELL_COL(c[0]);
+    move(y, x);
+    _cons_attrset(col);
+    for (i = 0; i < n; ++i) {
+        if (CELL_CP(c[i]) == CELL_WIDE_R)
+            continue;
+        if (brk || CELL_COL(c[i]) != col || len + 4 > sizeof(buf) / sizeof(buf[0])) {
+            _cons_addText(buf, len);
+            _cons_PRIVATE_statsAdd(out_units, len);
+            len = 0;
+            if (brk)
+                move(y, x + i);
+            brk = 0;
+            if (CELL_COL(c[i]) != col) {
+                col = CELL_COL(c[i]);
+                _cons_attrset(col);
+            }
+        }
+        len += _cons_encode(buf + len, CELL_CP(c[i]));
+        brk  = (c[i] & CELL_AMBI) != 0;
+    }
+    _cons_addText(buf, len);
+    _cons_PRIVATE_statsAdd(out_units, len);
+}
+
+/** Give curses the cells of the dirty spans that differ from the shadow.
+ *  @return number of runs given. 0 when nothing changed.
+ */
+static unsigned _cons_present(void) {
+    cons_cell_t CONS_CELL_FAR* cells;
+    cons_cell_t CONS_CELL_FAR* shadow;
+    unsigned    y, i, n, x, runs = 0;
+    for (y = s_text.screen.dirty_y0; y < (unsigned)s_text.screen.dirty_y1; ++y) {
+        cells  = cons_cbufAt(&s_text.screen, 0, y);
+        shadow = cons_cbufAt(&s_shadow, 0, y);
+        i      = s_text.screen.dirty_x0[y];
+        while ((n = cons_cbufDiff(cells, shadow, s_text.screen.dirty_x1[y], &i)) != 0) {
+            x = i - n;
+            if (x > 0 && CELL_CP(cells[x]) == CELL_WIDE_R)  // Starts at a right half.
+                --x;
+            if (i < (unsigned)s_text.screen.w && CELL_CP(cells[i]) == CELL_WIDE_R) {
+                shadow[i] = cells[i];
+                ++i;
+            }
+            _cons_emitRun(y, x, cells + x, i - x);
+            ++runs;
+        }
+    }
+    cons_cbufClean(&s_text.screen);
+    s_pairFull = 0;
+    return runs;
+}
+
+/** refresh(). Wrapped in synchronized output when the terminal has it
+ *  and the frame has changes; an empty frame does not send the wrapper.
+ */
+static void _cons_refresh(unsigned runs) {
+ #if !defined(CONS_USE_PDCURSES)
+    if (s_sync && runs) {
+        putp(tparm((char*)s_sync, 1));
+        fflush(stdout);     // putp() is buffered apart from refresh().
+        refresh();
+        putp(tparm((char*)s_sync, 2));
+        fflush(stdout);
+        return;
+    }
+ #else
+    (void)runs;
+ #endif
+    refresh();
+}
+
 int cons_init(unsigned flags) {
-    (void)flags;
+    s_text.ambiWide    = (flags & CONS_INIT_AMBI_WIDE) != 0;
+    _cons_PRIVATE_text = &s_text;
  #if !defined(CONS_USE_PDCURSES)
     setlocale(LC_ALL, "");
  #elif (defined(_WIN32) && defined(CONS_USE_UNICODE))   // nennotame
@@ -73,8 +407,10 @@ int cons_init(unsigned flags) {
     noecho();
     cbreak();
     keypad(stdscr, TRUE);
+    idlok(stdscr, TRUE);    // Moved rows are scrolled (csr+ind/ri or il/dl) by curses.
     curs_set(0);
     _cons_updateScreenSize();
+    _cons_resizeBuffers();
 
     if (has_colors() == FALSE) {
         endwin();
@@ -82,25 +418,28 @@ int cons_init(unsigned flags) {
     }
 
     start_color();
-    {
-        static int const cols[8] = { COLOR_BLACK, COLOR_BLUE, COLOR_RED, COLOR_MAGENTA,
-                        COLOR_GREEN, COLOR_CYAN, COLOR_YELLOW, COLOR_WHITE };
-        int i = 0;
-        start_color();
-        for (i = 0; i < 8; ++i) {
-            if (i)
-                init_pair(   i,   cols[i], COLOR_BLACK);
-            init_pair(     8|i, 8|cols[i], COLOR_BLACK);
-            init_pair(0x10|  i, COLOR_BLACK,   cols[i]);
-            init_pair(0x10|8|i, COLOR_BLACK, 8|cols[i]);
-        }
-    }
+    // Pairs are made on first use of a color. (_cons_attrset)
+    memset(s_colPair, 0, sizeof s_colPair);
+    memset(s_pair, 0, sizeof s_pair);
+    s_pairMax = (COLOR_PAIRS - 1 < CONS_CURSES_PAIRS) ? COLOR_PAIRS - 1 : CONS_CURSES_PAIRS;
 
-    timeout(50);    // getch timeout (milliseconds)
+    // getch timeout (milliseconds). No wait while playing back.
+    timeout(cons_replayMode() == CONS_REPLAY_PLAY ? 0 : 50);
+ #if !defined(CONS_USE_PDCURSES)
+    s_sync = tigetstr((char*)"Sync");
+    if (s_sync == (char const*)-1)
+        s_sync = NULL;
+ #endif
+    cons_statsReset();
     return 1;
 }
 
 void cons_term(void) {
+    _cons_present();        // A frame kept back by the pacing.
+    refresh();
+    cons_replayClose();
+    cons_cbufTerm(&s_shadow);
+    cons_cbufTerm(&s_text.screen);
     endwin();
  #if (defined(_WIN32) && defined(CONS_USE_UNICODE))
     SetConsoleOutputCP(_cons_win_codepage);
@@ -108,23 +447,29 @@ void cons_term(void) {
 }
 
 void cons_updateBegin(void) {
+    cons_key_t k;
+    _cons_PRIVATE_statsBegin();
     _cons_cur_clock = (cons_clock_t)(_con_getCurrentTimer()-_cons_start_clock);
     _cons_cur_tick  = _cons_cur_clock * CONS_TICK_PER_SEC / CONS_CLOCK_PER_SEC;
-    _cons_cur_key   = (cons_key_t)getch();
+    k               = (cons_key_t)getch();
+    _cons_PRIVATE_replayFrame(&_cons_cur_clock, &_cons_cur_tick, &k);
 
     _cons_updateScreenSize();
+    if (_cons_screen_width != s_text.screen.w || _cons_screen_height != s_text.screen.h)
+        _cons_resizeBuffers();
+    _cons_PRIVATE_statsBegun(&k);
+    _cons_cur_key   = k;
 }
 
 void cons_updateEnd(void) {
-    refresh();
-}
-
-void cons_clear(void) {
- #if defined(CONS_USE_PDCURSES)
-    clear();
- #else
-    erase();
- #endif
+    unsigned long t;
+    _cons_PRIVATE_statsEnd();
+    if (_cons_PRIVATE_paceReady(&s_pace, _cons_outFd())) {
+        t = _cons_PRIVATE_statsUsec();
+        _cons_refresh(_cons_present());
+        _cons_PRIVATE_paceSent(&s_pace, _cons_outFd(), t);
+    }
+    _cons_PRIVATE_statsEnded();
 }
 
 cons_clock_t cons_clock(void) {
@@ -146,60 +491,3 @@ cons_pos_t   cons_screenWidth(void) {
 cons_pos_t   cons_screenHeight(void) {
     return _cons_screen_height;
 }
-
-void cons_setxy(cons_pos_t x, cons_pos_t y) {
-    move(y, x);
-}
-
-void cons_setcolor(cons_col_t col) {
-    attron(COLOR_PAIR(col)); // | A_BOLD);
-}
-
-void cons_resetcolor(cons_col_t col) {
-    attroff(COLOR_PAIR(col)); // | A_BOLD);
-}
-
-void cons_puts(char const* s) {
-    addstr(s);
-}
-
-void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* s) {
-    move(y, x);
-    cons_puts(s);
-}
-
-void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t c, char const* s) {
-    move(y, x);
-    cons_setcolor(c);
-    cons_puts(s);
-}
-
-void cons_printf(char const* fmt, ...) {
-    char buf[CONS_PRINTF_BUF_SIZE];
-    va_list arg;
-    va_start(arg, fmt);
-    vsnprintf(buf, CONS_PRINTF_BUF_SIZE-1, fmt, arg);
-    buf[CONS_PRINTF_BUF_SIZE-1] = 0;
-    cons_puts(buf);
-    va_end(arg);
-}
-
-void cons_xyprintf(cons_pos_t x, cons_pos_t y, char const* fmt, ...) {
-    char buf[CONS_PRINTF_BUF_SIZE];
-    va_list arg;
-    va_start(arg, fmt);
-    vsnprintf(buf, CONS_PRINTF_BUF_SIZE-1, fmt, arg);
-    buf[CONS_PRINTF_BUF_SIZE-1] = 0;
-    cons_xyputs(x, y, buf);
-    va_end(arg);
-}
-
-void cons_xycprintf(cons_pos_t x, cons_pos_t y, cons_col_t c, char const* fmt, ...) {
-    char buf[CONS_PRINTF_BUF_SIZE];
-    va_list arg;
-    va_start(arg, fmt);
-    vsnprintf(buf, CONS_PRINTF_BUF_SIZE-1, fmt, arg);
-    buf[CONS_PRINTF_BUF_SIZE-1] = 0;
-    cons_xycputs(x, y, c, buf);
-    va_end(arg);
-}
@@ -20,6 +20,7 @@
 #define CONS_KEY_RETURN         0x0a
 #define CONS_KEY_ESC            0x1B
 #define CONS_KEY_SPACE          0x20
+#define CONS_KEY_STATS          0x14    ///< Ctrl-T. Toggles the stats overlay.
 
 #define CONS_COL_DEFAULT        0
 #define CONS_COL_BLACK          16
@@ -68,6 +69,14 @@ typedef signed char    cons_pos_t;
 #endif
 typedef unsigned char  cons_col_t;
 typedef unsigned short cons_key_t;
+#if defined(__DOS__)
+typedef unsigned long  cons_cell_t;     ///< (color << 24) | character code.
+#else
+typedef unsigned int   cons_cell_t;     ///< (color << 24) | unicode code point.
+#endif
+typedef cons_cell_t const* cons_enc_t;
+
+#define CONS_INIT_AMBI_WIDE     0x40    ///< East Asian Ambiguous characters are 2 columns.
 
 int  cons_init(unsigned flags);
 void cons_term(void);
@@ -78,6 +87,9 @@ void cons_updateEnd(void);
 cons_clock_t cons_clock(void);
 cons_clock_t cons_tick(void);
 cons_key_t   cons_key(void);
+#define cons_keyHeld(k)     ((k) == cons_key())     // No key-held state on terminals.
+#define cons_frameOverrun() 0UL                     // No vblank on terminals.
+#define cons_wakeAt(clk)                            ((void)0)   // Only the server schedules frames.
 cons_pos_t   cons_screenWidth(void);
 cons_pos_t   cons_screenHeight(void);
 
@@ -91,10 +103,22 @@ void cons_puts(char const* msg);
 void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* msg);
 void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t col, char const* msg);
 
+cons_enc_t cons_encode(char const* msg);
+void cons_encodeFree(cons_enc_t e);
+void cons_xycputEncoded(cons_pos_t x, cons_pos_t y, cons_col_t col, cons_enc_t e);
+
 void cons_printf(char const* fmt, ...);
 void cons_xyprintf(cons_pos_t x, cons_pos_t y, char const* fmt, ...);
 void cons_xycprintf(cons_pos_t x, cons_pos_t y, cons_col_t col, char const* fmt, ...);
 
-#define cons_setRefreshRect(n,x,y,w,h)
+#define cons_setRefreshRect(n,x,y,w,h)  ((void)0)
+
+#include "cons_cell.h"
+#include "cons_attr.h"
+#include "cons_glyph.h"
+#include "cons_replay.h"
+#include "cons_stats.h"
+#include "cons_trace.h"
+#include "cons_surface.h"
 
 #endif //CONS_CURSES_H__
@@ -0,0 +1,63 @@
+/**
+ *  @file cons_glyph.c
+ *  @brief Registry of short strings drawn many times per frame.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ */
+#include "cons.h"
+#include <string.h>
+
+typedef struct cons_glyph_ent_t {
+    unsigned short  ofs;        ///< First cell in s_glyphCells[].
+    unsigned char   n;          ///< Number of cells. Also the width in columns.
+} cons_glyph_ent_t;
+
+static cons_glyph_ent_t s_glyphs[CONS_GLYPH_MAX];
+static cons_cell_t      s_glyphCells[CONS_GLYPH_CELLS];
+static unsigned         s_glyphNum      = 1;    ///< [0] is CONS_GLYPH_NONE.
+static unsigned         s_glyphCellNum  = 0;
+
+/** Register str and get its id.
+ *  The cells have no color. cons_makeCell(ch, col) must be
+ *  cons_makeCell(ch, 0) | cons_makeCell(0, col) on every backend.
+ *  @return id. CONS_GLYPH_NONE for "", or when the registry is full.
+ */
+cons_glyph_t cons_glyphRegister(char const* str) {
+    cons_cell_t* d    = &s_glyphCells[s_glyphCellNum];
+    unsigned     rest = CONS_GLYPH_CELLS - s_glyphCellNum;
+    unsigned     n, i;
+    if (s_glyphNum >= CONS_GLYPH_MAX)
+        return CONS_GLYPH_NONE;
+    n = cons_encodeCells(d, str, rest > 255 ? 255 : rest);
+    if (n == 0)
+        return CONS_GLYPH_NONE;
+    for (i = 1; i < s_glyphNum; ++i) {  // Intern. Same cells, same id.
+        if (s_glyphs[i].n == n && memcmp(&s_glyphCells[s_glyphs[i].ofs], d, n * sizeof(cons_cell_t)) == 0)
+            return (cons_glyph_t)i;
+    }
+    s_glyphs[s_glyphNum].ofs = (unsigned short)s_glyphCellNum;
+    s_glyphs[s_glyphNum].n   = (unsigned char)n;
+    s_glyphCellNum += n;
+    return (cons_glyph_t)s_glyphNum++;
+}
+
+/** Width of a glyph in columns.
+ */
+unsigned cons_glyphWidth(cons_glyph_t id) {
+    return s_glyphs[id].n;
+}
+
+/** Put a glyph at (x, y) of the buffer b with color col.
+ */
+void cons_cbufPutGlyph(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_col_t col, cons_glyph_t id) {
+    cons_glyph_ent_t const* g = &s_glyphs[id];
+    if (g->n)
+        cons_cbufPutRow(b, x, y, &s_glyphCells[g->ofs], g->n, cons_makeCell(0, col));
+}
+
+/** Put a glyph at (x, y) with color col.
+ */
+void cons_putGlyph(cons_pos_t x, cons_pos_t y, cons_col_t col, cons_glyph_t id) {
+    cons_cbufPutGlyph(cons_screen(), x, y, col, id);
+}
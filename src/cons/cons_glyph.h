@@ -0,0 +1,33 @@
+/**
+ *  @file cons_glyph.h
+ *  @brief Registry of short strings drawn many times per frame.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   A string is decoded to cells once by cons_glyphRegister(). The same cells
+ *   get the same id. cons_putGlyph() only ORs the color to the cells and
+ *   stores them to the screen; no string is parsed on the hot path.
+ *   Register after cons_init(). (curses measures widths with its flags.)
+ *   Glyphs do not wrap. Cells out of the screen are clipped.
+ */
+#ifndef CONS_GLYPH_H__
+#define CONS_GLYPH_H__
+
+#ifndef CONS_GLYPH_MAX
+#define CONS_GLYPH_MAX          64      ///< Number of glyphs. Id 0 is the empty glyph.
+#endif
+#ifndef CONS_GLYPH_CELLS
+#define CONS_GLYPH_CELLS        256     ///< Cells of all glyphs.
+#endif
+
+typedef unsigned char cons_glyph_t;     ///< Glyph id.
+
+#define CONS_GLYPH_NONE         0       ///< Empty glyph. Also returned when the registry is full.
+
+cons_glyph_t cons_glyphRegister(char const* str);
+unsigned     cons_glyphWidth(cons_glyph_t id);
+void         cons_putGlyph(cons_pos_t x, cons_pos_t y, cons_col_t col, cons_glyph_t id);
+void         cons_cbufPutGlyph(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y, cons_col_t col, cons_glyph_t id);
+
+#endif //CONS_GLYPH_H__
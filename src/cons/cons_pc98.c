@@ -24,7 +24,12 @@
 #include <assert.h>
 
 #define CONS_USE_SJIS
-//#define CONS_USE_NEAR_TEXT_BUF
+#if !defined(__FLAT__) && (defined(__SMALL__) || defined(__ia16__))
+#define CONS_USE_NEAR_TEXT_BUF      // Text buffers in DGROUP.
+#endif
+//#define CONS_USE_KEY_INTR         // Read the keyboard with own INT 9 handler.
+                                    // It does not chain to the BIOS handler: STOP, CTRL+C and the
+                                    // SIGINT/SIGBREAK restore path do not work while it is installed.
 
 #if defined(__FLAT__)
 //#define USE_T10MS
@@ -47,25 +52,57 @@
 #define FAR_PTR_OFF(p)  ((uint16_t)((uint32_t)(p)))
 #endif
 
+#if defined(CONS_USE_NEAR_TEXT_BUF)
+#define TEXT_BUF_FAR
+#else
+#define TEXT_BUF_FAR    __far
+#endif
+
+/** Copy n words from a text buffer to VRAM.
+ */
+#if defined(CONS_USE_NEAR_TEXT_BUF) && defined(__WATCOMC__)
+void vramCopyWords(uint16_t __far* dst, uint16_t const* src, unsigned n);
+#pragma aux vramCopyWords =     \
+    "rep movsw"                 \
+    parm [es di] [si] [cx]      \
+    modify [di si cx]
+#elif defined(CONS_USE_NEAR_TEXT_BUF) && defined(__ia16__)
+static inline void vramCopyWords(uint16_t __far* dst, uint16_t const* src, unsigned n) {
+    uint16_t seg = FAR_PTR_SEG(dst);
+    uint16_t off = FAR_PTR_OFF(dst);
+    __asm__ volatile ("push %%es\n\tmov %3, %%es\n\tcld\n\trep movsw\n\tpop %%es"
+                      : "+D"(off), "+S"(src), "+c"(n) : "r"(seg) : "memory");
+}
+#else
+#define vramCopyWords(d,s,n)    _fmemcpy((d), (s), (n) * sizeof(uint16_t))
+#endif
+
 #define TEXT_VRAM       ((uint16_t __far*)MK_FAR_PTR(0xA000,0x0000))
 #define ATTR_VRAM       ((uint16_t __far*)MK_FAR_PTR(0xA200,0x0000))
 #define TEXT_BUF_W      80
 #define TEXT_BUF_H      25
-#define TEXT_BUF_BYTES  (TEXT_BUF_W * TEXT_BUF_H * sizeof(uint16_t))
+#define TEXT_BUF_SIZE   (TEXT_BUF_W * TEXT_BUF_H)
+#define TEXT_BUF_BYTES  (TEXT_BUF_SIZE * sizeof(uint16_t))
 
 //extern unsigned char __isPC98;    // watcom
 
-#if !defined(CONS_USE_NEAR_TEXT_BUF)
-static uint16_t __far*  s_textBuf   = NULL;
-static uint16_t __far*  s_attrBuf   = NULL;
-#else
+/** A cell is (attribute << 16) | text VRAM code.
+ *  The buffers keep it in two planes (CONS_CELL_PLANES): text codes and attributes.
+ */
+#define PC98_CELL(ch,at)    (((cons_cell_t)(at) << 16) | (ch))
+
+static cons_cbuf_t      s_screen;                   ///< The screen.
+static cons_cbuf_t      s_shadow;                   ///< What is in TEXT_VRAM/ATTR_VRAM now.
+static cons_plane_t TEXT_BUF_FAR* s_textBuf    = NULL;  ///< s_screen.cells
+static cons_plane_t TEXT_BUF_FAR* s_attrBuf    = NULL;  ///< s_screen.attrs
+static cons_plane_t TEXT_BUF_FAR* s_textShadow = NULL;  ///< s_shadow.cells
+static cons_plane_t TEXT_BUF_FAR* s_attrShadow = NULL;  ///< s_shadow.attrs
+#if defined(CONS_USE_NEAR_TEXT_BUF)
 typedef struct aln_t {
     void*   p;
     double  d;
 } aln_t;
-static aln_t            s_buff[(2*TEXT_BUF_BYTES + 16) / sizeof(aln_t)];
-static uint16_t*        s_textBuf = NULL;
-static uint16_t*        s_attrBuf = NULL;
+static aln_t            s_buff[(4 * TEXT_BUF_BYTES + 16) / sizeof(aln_t)];
 #endif
 
 static cons_col_t       s_cur_col   = 0;
@@ -78,13 +115,6 @@ cons_pos_t              _cons_PRIVATE_screen_height = TEXT_BUF_H;
 cons_pos_t              _cons_PRIVATE_cur_x;
 cons_pos_t              _cons_PRIVATE_cur_y;
 
-typedef struct cons_rect_t {
-    cons_pos_t  x, y;
-    cons_pos_t  w, h;
-} cons_rect_t;
-
-static cons_rect_t const text_full_rect = { 0,0,TEXT_BUF_W,TEXT_BUF_H };
-static cons_rect_t      s_refresh_rect[CONS_REFRESH_RECT_N];
 static char             s_cons_sprintf_buf[CONS_PRINTF_BUF_SIZE];
 
 
@@ -165,6 +195,98 @@ static void key_bufClr(void) {
 }
 
 
+#if defined(CONS_USE_KEY_INTR)
+
+/** Keyboard events from INT 9.  bit7:break  bit6-0:scan code.
+ */
+#define KEY_RING_N  32  // power of 2.
+static uint8_t volatile     s_key_ring[KEY_RING_N];
+static uint8_t volatile     s_key_ring_w;
+static uint8_t volatile     s_key_ring_r;
+static uint8_t volatile     s_key_held[128 / 8];
+static void (__interrupt __far *s_key_handler_old)(void) = NULL;
+
+/** Scan code -> ascii. [0]:normal [1]:shift
+ */
+static char const s_key_ascii[2][0x35] = {
+    "\033" "1234567890-^\\\b\t" "qwertyuiop@[\r" "asdfghjkl;:]" "zxcvbnm,./_ ",
+    "\033" "!\"#$%&'()0=~|\b\t"   "QWERTYUIOP`{\r" "ASDFGHJKL+*}" "ZXCVBNM<>?_ ",
+};
+
+#define key_isHeld(i)   ((s_key_held[(i) >> 3] >> ((i) & 7)) & 1)
+
+/** Keyboard interrupt handler. Push make/break codes to the ring.
+ */
+static void __interrupt __far key_handler(void) {
+    uint8_t sc = inp(0x41);
+    uint8_t i  = sc & 0x7f;
+    if (sc & 0x80)
+        s_key_held[i >> 3] &= ~(1 << (i & 7));
+    else
+        s_key_held[i >> 3] |=  (1 << (i & 7));
+    if (((s_key_ring_w + 1) & (KEY_RING_N - 1)) != s_key_ring_r) {
+        s_key_ring[s_key_ring_w] = sc;
+        s_key_ring_w = (s_key_ring_w + 1) & (KEY_RING_N - 1);
+    }
+    outp(0x00, 0x20);       // EOI.
+}
+
+/** Install the keyboard interrupt handler.
+ */
+static void key_intrInit(void) {
+    s_key_ring_r = s_key_ring_w = 0;
+    memset((void*)s_key_held, 0, sizeof(s_key_held));
+    s_key_handler_old = _dos_getvect(0x09);
+    _dos_setvect(0x09, key_handler);
+}
+
+/** Restore the keyboard interrupt handler.
+ */
+static void key_intrTerm(void) {
+    if (s_key_handler_old) {
+        _disable();
+        _dos_setvect(0x09, s_key_handler_old);
+        _enable();
+        s_key_handler_old = NULL;
+    }
+}
+
+/** Scan code -> cons_key_t (same values as key_getch). CONS_KEY_ERR for shift keys.
+ */
+static cons_key_t key_fromCode(unsigned sc, unsigned shift) {
+    uint8_t c;
+    sc &= 0x7f;
+    if (sc >= 0x70 && sc <= 0x74)   // SHIFT CAPS KANA GRPH CTRL
+        return CONS_KEY_ERR;
+    if (sc >= 0x35)
+        return sc << 8;
+    c = (uint8_t)s_key_ascii[shift][sc];
+    return (c >= ' ') ? c : (sc << 8) | c;
+}
+
+/** Pop one key press from the ring.
+ */
+static cons_key_t key_ringGet(void) {
+    uint8_t    sc;
+    cons_key_t k;
+    while (s_key_ring_r != s_key_ring_w) {
+        sc = s_key_ring[s_key_ring_r];
+        s_key_ring_r = (s_key_ring_r + 1) & (KEY_RING_N - 1);
+        if (sc & 0x80)      // break.
+            continue;
+        k = key_fromCode(sc, key_isHeld(0x70));
+        if (k != CONS_KEY_ERR)
+            return k;
+    }
+    return CONS_KEY_ERR;
+}
+
+#else
+#define key_intrInit()
+#define key_intrTerm()
+#endif  // CONS_USE_KEY_INTR
+
+
 #if 0
 static int key_scan(void) {
     union REGS regs;
@@ -361,11 +483,56 @@ static inline cons_clock_t vsync_counterGet(void) {
 #define t10ms_getMilliSec()     (s_vsync_count * 1000 / 60)
 #endif
 
+/** Micro seconds for cons_stats. As fine as t10ms_getMilliSec().
+ */
+unsigned long _cons_PRIVATE_statsUsec(void) {
+    return (unsigned long)t10ms_getMilliSec() * 1000UL;
+}
+
+static unsigned long    s_frame_overrun;    ///< Number of late frames.
+#if defined(USE_VSYNC_INTR)
+static uint32_t         s_frame_vsync;      ///< vsync count at the last present.
+#endif
+
+/** Is the display in vblank now?
+ */
+static int vsync_inVblank(void) {
+    return (inp(0xA0) & 0x20) != 0;
+}
+
+/** Wait for the next vblank, unless one was already missed or it is vblank now.
+ */
+static void vsync_presentWait(void) {
+    if (cons_replayMode() == CONS_REPLAY_PLAY)
+        return;
+  #if defined(USE_VSYNC_INTR)
+    {
+        uint32_t d;
+        _disable();
+        d = s_vsync_count - s_frame_vsync;
+        _enable();
+        if (d == 0) {
+            vsync_wait();
+            d = 1;
+        } else if (d > 1 || !vsync_inVblank()) {
+            ++s_frame_overrun;  // Late. Waiting would cost almost one more refresh.
+        }
+        s_frame_vsync += d;
+    }
+  #else
+    if (!vsync_inVblank())
+        vsync_wait();
+  #endif
+}
+
 
 
 // ================================================================
 
 static void consRefresh(void);
+#if defined(CONS_USE_SJIS)
+static void sjis_initTable(void);
+#endif
 
 /** Initialize.
  */
@@ -376,139 +543,187 @@ int  cons_init(unsigned flags) {
     text_cursorSw(0);
     //text_PFKeySw(0);
     if (!s_textBuf) {
-      #if !defined(CONS_USE_NEAR_TEXT_BUF)
-        size_t size = TEXT_BUF_BYTES;
-        s_textBuf   = (uint16_t __far*)_fmalloc(2 * size * sizeof(uint16_t));
-        s_attrBuf   = s_textBuf + size;
-        _fmemset(s_textBuf, 0, 2 * size * sizeof(uint16_t));
+        cons_plane_t TEXT_BUF_FAR* shadow = NULL;
+      #if defined(CONS_USE_NEAR_TEXT_BUF)
+        s_textBuf = (cons_plane_t*)(((uintptr_t)s_buff + 15) & ~15);
+        shadow    = s_textBuf + 2 * TEXT_BUF_SIZE;
+      #endif
+        if (!cons_cbufInit(&s_screen, TEXT_BUF_W, TEXT_BUF_H, s_textBuf)
+            || !cons_cbufInit(&s_shadow, TEXT_BUF_W, TEXT_BUF_H, shadow)
+        ) {
+            cons_cbufTerm(&s_screen);
+            s_textBuf = NULL;
+            return 0;
+        }
+      #if defined(CONS_USE_NEAR_TEXT_BUF)
+        s_attrBuf    = s_textBuf + TEXT_BUF_SIZE;
+        s_textShadow = shadow;
+        s_attrShadow = shadow + TEXT_BUF_SIZE;
       #else
-        s_textBuf = (uint16_t*)(((uintptr_t)s_buff + 15) & ~15);
-        s_attrBuf = s_textBuf + TEXT_BUF_W * TEXT_BUF_H;
+        s_textBuf    = s_screen.cells;
+        s_attrBuf    = s_screen.attrs;
+        s_textShadow = s_shadow.cells;
+        s_attrShadow = s_shadow.attrs;
       #endif
     }
     _fmemset(TEXT_VRAM, 0, TEXT_BUF_BYTES);
     _fmemset(ATTR_VRAM, 0, TEXT_BUF_BYTES);
+    cons_cbufFill(&s_shadow, 0, 0, TEXT_BUF_W, TEXT_BUF_H, 0);
     vsync_counterInit();
+  #if defined(USE_VSYNC_INTR)
+    s_frame_vsync   = s_vsync_count;
+  #endif
+    s_frame_overrun = 0;
     t10ms_init();
+  #if defined(CONS_USE_SJIS)
+    sjis_initTable();
+  #endif
+    key_intrInit();
     cons_setcolor(7);
     cons_clear();
     consRefresh();
+    cons_statsReset();
     return 1;
 }
 
 /** Terminate.
  */
 void cons_term(void) {
+    cons_replayClose();
+    key_intrTerm();
     t10ms_term();
     vsync_counterTerm();
-    s_refresh_rect[0] = text_full_rect;
     cons_clear();
     consRefresh();
     text_cursorSw(1);
     //text_PFKeySw(1);
-  #if !defined(CONS_USE_NEAR_TEXT_BUF)
-    _ffree(s_textBuf);
-  #endif
+    cons_cbufTerm(&s_shadow);
+    cons_cbufTerm(&s_screen);
     s_textBuf = NULL;
-    s_attrBuf = NULL;
 }
 
 /** update-begin
  */
 void cons_updateBegin(void) {
-    memset(s_refresh_rect, 0, sizeof(s_refresh_rect));
-    s_refresh_rect[0] = text_full_rect;
-
+    _cons_PRIVATE_statsBegin();
     cons_setxy(0,0);
     cons_setcolor(7);
     _cons_PRIVATE_clock   = t10ms_getMilliSec();
     _cons_PRIVATE_tick    = vsync_counterGet();
+  #if defined(CONS_USE_KEY_INTR)
+    _cons_PRIVATE_key     = key_ringGet();
+  #else
     _cons_PRIVATE_key     = CONS_KEY_ERR;
     if (key_kbHit()) {
         _cons_PRIVATE_key = key_getch();
         key_bufClr();
     }
+  #endif
+    _cons_PRIVATE_replayFrame(&_cons_PRIVATE_clock, &_cons_PRIVATE_tick, &_cons_PRIVATE_key);
+    _cons_PRIVATE_statsBegun(&_cons_PRIVATE_key);
+}
+
+/** Is the key held down now?
+ *  Without CONS_USE_KEY_INTR, only the key of this frame.
+ */
+int cons_keyHeld(cons_key_t key) {
+  #if defined(CONS_USE_KEY_INTR)
+    unsigned i;
+    if (cons_replayMode() == CONS_REPLAY_PLAY)
+        return key == _cons_PRIVATE_key;
+    for (i = 0; i < 128; ++i) {
+        if (s_key_held[i >> 3] == 0) {
+            i |= 7;
+            continue;
+        }
+        if (key_isHeld(i) && (key_fromCode(i, 0) == key || key_fromCode(i, 1) == key))
+            return 1;
+    }
+    return 0;
+  #else
+    return key == _cons_PRIVATE_key;
+  #endif
 }
 
 /** update-end
  */
 void cons_updateEnd(void) {
-    vsync_wait();
+    _cons_PRIVATE_statsEnd();
+    vsync_presentWait();
     consRefresh();
+    _cons_PRIVATE_statsEnded();
+}
+
+/** Number of frames that missed their vblank since cons_init.
+ *  Games can compare it with the previous value and draw less.
+ *  Counted only with USE_VSYNC_INTR.
+ */
+unsigned long cons_frameOverrun(void) {
+    return s_frame_overrun;
 }
 
 /** Screen clear.
  */
 void cons_clear(void) {
-    unsigned short offset = 0;
-    unsigned x, y;
-    for (y = 0; y < TEXT_BUF_H; ++y) {
-        for (x = 0; x < TEXT_BUF_W; ++x) {
-            s_textBuf[offset] = ' ';
-            s_attrBuf[offset] = s_cur_col;
-            ++offset;
-        }
-    }
+    cons_cbufFill(&s_screen, 0, 0, TEXT_BUF_W, TEXT_BUF_H, PC98_CELL(' ', s_cur_col));
     cons_setxy(0, 0);
 }
 
-
 /** Set screen refresh rect.
+ *  Kept for compatibility. Written cells are tracked automatically,
+ *  so this only forces the rect to be compared on the next refresh.
  */
 void cons_setRefreshRect(uint8_t no, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h) {
-    cons_rect_t* rt = &s_refresh_rect[no];
+    int i;
     assert(no < CONS_REFRESH_RECT_N);
-    rt->x = x;
-    rt->y = y;
-    rt->w = w;
-    rt->h = h;
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > TEXT_BUF_W) w = TEXT_BUF_W - x;
+    if (y + h > TEXT_BUF_H) h = TEXT_BUF_H - y;
+    if (w <= 0)
+        return;
+    for (i = 0; i < h; ++i)
+        cons_cbufMarkDirty(&s_screen, y + i, x, x + w);
+}
+
+/** Write to vram only the words of src[0..n) that differ from shadow[].
+ *  @return number of words written.
+ */
+static unsigned copyDiff(uint16_t __far* vram, cons_plane_t TEXT_BUF_FAR* shadow, cons_plane_t const TEXT_BUF_FAR* src, unsigned n) {
+    unsigned i = 0, j, m = 0;
+    for (;;) {
+        while (i < n && src[i] == shadow[i])    // repe cmpsw
+            ++i;
+        if (i >= n)
+            break;
+        j = i;
+        do {
+            shadow[j] = src[j];
+        } while (++j < n && src[j] != shadow[j]);
+        vramCopyWords(&vram[i], &src[i], j - i);
+        m += j - i;
+        i  = j;
+    }
+    return m;
 }
 
 /** Screen refresh.
+ *  Compare the dirty spans of each plane with the shadow of VRAM and write only the changed words.
  */
 static void consRefresh(void) {
-    cons_rect_t const* rt = &s_refresh_rect[0];
-    if (rt->w==TEXT_BUF_W && rt->h==TEXT_BUF_H && rt->x==0 && rt->y==0) {
-        _fmemcpy(TEXT_VRAM, s_textBuf, TEXT_BUF_BYTES);
-        _fmemcpy(ATTR_VRAM, s_attrBuf, TEXT_BUF_BYTES);
-    } else {
-        cons_rect_t const* rt_e = &s_refresh_rect[CONS_REFRESH_RECT_N];
-        do {
-            unsigned n, ofs, bytes;
-            int      x,y,w,h;
-            x  = rt->x;
-            w  = rt->w;
-            if (x <= 0) {
-                w += x;
-                x = 0;
-                if (w <= 0)
-                    continue;
-            } else if (x + w > TEXT_BUF_W) {
-                w = TEXT_BUF_W - x;
-                if (w <= 0)
-                    continue;
-            }
-            y  = rt->y;
-            h  = rt->h;
-            if (y <= 0) {
-                h += y;
-                y = 0;
-                if (h <= 0)
-                    continue;
-            } else if (y + h > TEXT_BUF_H) {
-                h = TEXT_BUF_H - y;
-                if (h <= 0)
-                    continue;
-            }
-            bytes = w * sizeof(uint16_t);
-            ofs   = y * TEXT_BUF_W + x;
-            for (n = 0; n < h; ++n) {
-                _fmemcpy(&TEXT_VRAM[ofs], &s_textBuf[ofs], bytes);
-                _fmemcpy(&ATTR_VRAM[ofs], &s_attrBuf[ofs], bytes);
-                ofs += TEXT_BUF_W;
-            }
-        } while (++rt < rt_e);
+    unsigned y, x0, n, ofs, nt, na;
+    for (y = s_screen.dirty_y0; y < (unsigned)s_screen.dirty_y1; ++y) {
+        x0 = s_screen.dirty_x0[y];
+        if (x0 >= (unsigned)s_screen.dirty_x1[y])
+            continue;
+        n   = s_screen.dirty_x1[y] - x0;
+        ofs = y * TEXT_BUF_W + x0;
+        nt  = copyDiff(&TEXT_VRAM[ofs], &s_textShadow[ofs], &s_textBuf[ofs], n);
+        na  = copyDiff(&ATTR_VRAM[ofs], &s_attrShadow[ofs], &s_attrBuf[ofs], n);
+        _cons_PRIVATE_statsAdd(out_units, nt + na);
+        _cons_PRIVATE_statsAdd(cells_changed, (nt > na) ? nt : na);
     }
+    cons_cbufClean(&s_screen);
 }
 
 /** color to attr.
@@ -526,9 +741,23 @@ void cons_setcolor(cons_col_t atr_col) {
     s_cur_col = colToAtr(atr_col);
 }
 
+/** Make a cell of ch and color co.
+ *  @param ch   ASCII, or a text VRAM code from cons_encode().
+ */
+cons_cell_t cons_makeCell(unsigned ch, cons_col_t co) {
+    return PC98_CELL((uint16_t)ch, colToAtr(co));
+}
+
+/** The screen buffer. Valid between cons_init and cons_term.
+ */
+cons_cbuf_t* cons_screen(void) {
+    return &s_screen;
+}
+
 /** Set position(x,y) and put string.
  */
 void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t co, char const* s) {
+    _cons_PRIVATE_statsAdd(puts_calls, 1);
     cons_setcolor(co);
     cons_setxy(x,y);
     cons_puts(s);
@@ -543,26 +772,34 @@ void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* s) {
 
 #if defined(CONS_USE_SJIS)
 #define iskanji(c)  (((c)>=0x81 && (c)<=0x9f) || ((c)>=0xE0 && (c)<=0xfc))
+#define istrail(c)  ((c) >= 0x40 && (c) <= 0xfc)
 
-/** SJIS->JIS
- */
-static uint16_t sjisToJis(uint16_t ax) {
-    uint8_t al;
-    uint8_t ah = ax >> 8;
-    if (ah >= 0xa0)
-        ah -= 0x40;
-    ah -= 0x70;
-    al = (uint8_t)ax;
-    if ((int8_t)al < 0)    // al >= 0x80
-        --al;
-    ah <<= 1;
-    if (al < 0x9e)
-        --ah;
-    else
-        al -= 0x5e;
-    al -= 0x1f;
-    return (ah << 8) | al;
+static uint8_t  s_sjisLead[0x40];           ///< (lead & 0x3f) -> JIS row - 0x20 (odd row).
+static uint16_t s_sjisTrail[0xfd - 0x40];   ///< (trail - 0x40) -> (JIS cell << 8) | row add.
+
+/** Make the SJIS -> text VRAM code tables.
+ *  VRAM code is (JIS cell << 8) | (JIS row - 0x20).
+ */
+static void sjis_initTable(void) {
+    unsigned c, a;
+    for (c = 0x81; c <= 0xfc; ++c) {
+        if (!iskanji(c))
+            continue;
+        a = (c >= 0xa0) ? c - 0x40 : c;
+        s_sjisLead[c & 0x3f] = (uint8_t)(((a - 0x70) << 1) - 1 - 0x20);
+    }
+    for (c = 0x40; c <= 0xfc; ++c) {
+        a = (c >= 0x80) ? c - 1 : c;
+        if (a < 0x9e)
+            s_sjisTrail[c - 0x40] = (uint16_t)((a - 0x1f) << 8);
+        else
+            s_sjisTrail[c - 0x40] = (uint16_t)(((a - 0x5e - 0x1f) << 8) | 1);
+    }
 }
+
+/** SJIS -> text VRAM code (left half).
+ */
+#define sjisToVram(c,d)     ((uint16_t)(s_sjisTrail[(d) - 0x40] + s_sjisLead[(c) & 0x3f]))
 #endif
 
 /** Put string.
@@ -570,6 +807,9 @@ static uint16_t sjisToJis(uint16_t ax) {
 void cons_puts(char const* str) {
     uint8_t  const* s = (uint8_t const*)str;
     uint16_t offs     = (_cons_PRIVATE_cur_y*TEXT_BUF_W+_cons_PRIVATE_cur_x);
+    unsigned x0       = _cons_PRIVATE_cur_x;
+    uint16_t at       = s_cur_col;
+    unsigned put      = 0;
 
     while (*s) {
      #if defined(CONS_USE_SJIS)
@@ -579,26 +819,27 @@ void cons_puts(char const* str) {
                 _cons_PRIVATE_cur_x = TEXT_BUF_W;
             } else {
                 s_textBuf[offs] = c;
-                s_attrBuf[offs] = s_cur_col;
+                s_attrBuf[offs] = at;
                 ++offs;
                 ++_cons_PRIVATE_cur_x;
+                ++put;
             }
-        } else if (*s) {
-            unsigned sjis = (c << 8) | *s++;
-            uint16_t jis  = sjisToJis(sjis);
-            uint8_t  ah   = (uint8_t)(jis);
-            uint8_t  al   = (uint8_t)(jis >> 8);
-            uint16_t ax;
-            al -= 0x20;
-            ax = (ah << 8) | (al);
+        } else if (istrail(*s)) {
+            uint16_t ax = sjisToVram(c, *s);
+            ++s;
             s_textBuf[offs+0] = ax;
             s_textBuf[offs+1] = ax | 0x8080;
-            s_attrBuf[offs+0] = s_cur_col;
-            s_attrBuf[offs+1] = s_cur_col;
+            s_attrBuf[offs+0] = at;
+            s_attrBuf[offs+1] = at;
             offs += 2;
             _cons_PRIVATE_cur_x += 2;
+            put  += 2;
         }
         if (_cons_PRIVATE_cur_x >= TEXT_BUF_W) {
+            cons_cbufMarkDirty(&s_screen, _cons_PRIVATE_cur_y, x0, _cons_PRIVATE_cur_x);
+            if (_cons_PRIVATE_cur_x > TEXT_BUF_W)   // kanji over the right edge.
+                cons_cbufMarkDirty(&s_screen, _cons_PRIVATE_cur_y + 1, 0, 1);
+            x0 = 0;
             _cons_PRIVATE_cur_x = 0;
             if (++_cons_PRIVATE_cur_y >= TEXT_BUF_H)
                 _cons_PRIVATE_cur_y = 0;
@@ -610,11 +851,108 @@ void cons_puts(char const* str) {
             _cons_PRIVATE_cur_x = TEXT_BUF_W;
         } else {
             s_textBuf[offs] = c;
-            s_attrBuf[offs] = s_cur_col;
+            s_attrBuf[offs] = at;
             ++offs;
             ++_cons_PRIVATE_cur_x;
+            ++put;
+        }
+      #endif
+    }
+    cons_cbufMarkDirty(&s_screen, _cons_PRIVATE_cur_y, x0, _cons_PRIVATE_cur_x);
+    _cons_PRIVATE_statsAdd(cells_put, put);
+}
+
+/** Pre-encode a string to text VRAM codes.
+ *  Call after cons_init(). '\n' is not interpreted.
+ *  @return [0]:number of cells, [1..]:codes. Release with cons_encodeFree().
+ */
+cons_enc_t cons_encode(char const* str) {
+    uint8_t const* s = (uint8_t const*)str;
+    uint16_t*      e = (uint16_t*)malloc((strlen(str) + 1) * sizeof(uint16_t));
+    uint16_t*      d;
+    uint8_t        c;
+    if (!e)
+        return NULL;
+    d = e + 1;
+    while ((c = *s++) != 0) {
+      #if defined(CONS_USE_SJIS)
+        if (iskanji(c) && istrail(*s)) {
+            uint16_t ax = sjisToVram(c, *s);
+            ++s;
+            *d++ = ax;
+            *d++ = ax | 0x8080;
+            continue;
+        }
+      #endif
+        *d++ = c;
+    }
+    e[0] = (uint16_t)(d - (e + 1));
+    return e;
+}
+
+/** Encode str to cells without color. Used by cons_glyphRegister().
+ *  @return number of cells. 0 when str is "" or does not fit in max cells.
+ */
+unsigned cons_encodeCells(cons_cell_t* d, char const* str, unsigned max) {
+    uint8_t const* s = (uint8_t const*)str;
+    unsigned       n = 0;
+    uint8_t        c;
+    while ((c = *s++) != 0) {
+      #if defined(CONS_USE_SJIS)
+        if (iskanji(c) && istrail(*s)) {
+            uint16_t ax = sjisToVram(c, *s);
+            ++s;
+            if (n + 2 > max)
+                return 0;
+            d[n++] = ax;
+            d[n++] = ax | 0x8080;
+            continue;
         }
       #endif
+        if (n >= max)
+            return 0;
+        d[n++] = c;
+    }
+    return n;
+}
+
+/** Release a string made by cons_encode().
+ */
+void cons_encodeFree(cons_enc_t e) {
+    free((void*)e);
+}
+
+/** Set position(x,y) and put a string made by cons_encode().
+ */
+void cons_xycputEncoded(cons_pos_t x, cons_pos_t y, cons_col_t co, cons_enc_t e) {
+    uint16_t const* src;
+    unsigned        n, l, i, offs;
+    uint16_t        at;
+    if (!e)
+        return;
+    src = e + 1;
+    n   = e[0];
+    _cons_PRIVATE_statsAdd(cells_put, n);
+    cons_setcolor(co);
+    at  = s_cur_col;
+    cons_setxy(x, y);
+    while (n) {
+        l = TEXT_BUF_W - _cons_PRIVATE_cur_x;
+        if (l > n)
+            l = n;
+        offs = _cons_PRIVATE_cur_y * TEXT_BUF_W + _cons_PRIVATE_cur_x;
+        _fmemcpy(&s_textBuf[offs], src, l * sizeof(uint16_t));
+        for (i = 0; i < l; ++i)
+            s_attrBuf[offs + i] = at;
+        cons_cbufMarkDirty(&s_screen, _cons_PRIVATE_cur_y, _cons_PRIVATE_cur_x, _cons_PRIVATE_cur_x + l);
+        src += l;
+        n   -= l;
+        _cons_PRIVATE_cur_x += l;
+        if (_cons_PRIVATE_cur_x >= TEXT_BUF_W) {
+            _cons_PRIVATE_cur_x = 0;
+            if (++_cons_PRIVATE_cur_y >= TEXT_BUF_H)
+                _cons_PRIVATE_cur_y = 0;
+        }
     }
 }
 
@@ -19,6 +19,7 @@
 #define CONS_KEY_ESC            0x1B
 #define CONS_KEY_SPACE          0x20
 #define CONS_KEY_ERR            0xFFFF
+#define CONS_KEY_STATS          0x6B00  ///< f.10. Toggles the stats overlay.
 
 #define CONS_COL_DEFAULT        7
 #define CONS_COL_BLACK          0
@@ -63,9 +64,15 @@ typedef unsigned long  cons_clock_t;
 typedef signed char    cons_pos_t;
 typedef unsigned char  cons_col_t;
 typedef unsigned short cons_key_t;
+typedef unsigned short const* cons_enc_t;
+typedef unsigned long  cons_cell_t;     ///< (attribute << 16) | text VRAM code.
+#define CONS_CELL_PLANES                ///< Buffers keep text codes and attributes in two word planes.
 
 int  cons_init(unsigned flags);
 void cons_term(void);
+int  cons_keyHeld(cons_key_t key);
+unsigned long cons_frameOverrun(void);
+#define cons_wakeAt(clk)    ((void)0)   // Only the server schedules frames.
 
 void cons_updateBegin(void);
 void cons_updateEnd(void);
@@ -76,6 +83,10 @@ void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* msg);
 void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t col, char const* msg);
 void cons_setcolor(cons_col_t co);
 
+cons_enc_t cons_encode(char const* msg);
+void cons_encodeFree(cons_enc_t e);
+void cons_xycputEncoded(cons_pos_t x, cons_pos_t y, cons_col_t col, cons_enc_t e);
+
 #if 1 // private name.
     extern cons_clock_t _cons_PRIVATE_clock;
     extern cons_clock_t _cons_PRIVATE_tick;
@@ -105,4 +116,12 @@ void cons_setcolor(cons_col_t co);
 #define CONS_REFRESH_RECT_N     4
 void cons_setRefreshRect(unsigned char n, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h);
 
+#include "cons_cell.h"
+#include "cons_attr.h"
+#include "cons_glyph.h"
+#include "cons_replay.h"
+#include "cons_stats.h"
+#include "cons_trace.h"
+#include "cons_surface.h"
+
 #endif //CONS_P98_H__
@@ -16,6 +16,7 @@
 #include <malloc.h>
 #include <stdarg.h>
 #include <time.h>
+#include <signal.h>
 #include <assert.h>
 
 #if __STDC_VERSION__ >= 199901L || __cplusplus >= 201103L
@@ -29,6 +30,10 @@ typedef unsigned short  uint16_t;
 typedef unsigned char   bool;
 #endif
 
+//#define CONS_USE_KEY_INTR         // Read the keyboard with own INT 9 handler. Chains to the BIOS handler.
+//#define CONS_USE_PIT_INTR         // 1ms timer by reprogramming PIT channel 0 and hooking INT 8.
+//#define CONS_USE_NEAR_TEXT_BUF    // 16bit: text buffer in DGROUP. Up to 80x50.
+
 #if defined __FLAT__
 #undef __far
 #define __far
@@ -38,6 +43,39 @@ typedef unsigned char   bool;
 #define int86               int386
 #else
 #define MK_FAR_PTR(a,b)     (((uint32_t)(a) << 16) | (b))
+#define FAR_PTR_SEG(p)      ((uint16_t)((uint32_t)(void __far*)(p) >> 16))
+#define FAR_PTR_OFF(p)      ((uint16_t)((uint32_t)(void __far*)(p)))
+#endif
+
+#if defined(__FLAT__)
+#undef CONS_USE_NEAR_TEXT_BUF
+#endif
+
+#if defined(CONS_USE_NEAR_TEXT_BUF)
+#define TEXT_BUF_FAR
+#define NEAR_TEXT_BUF_SIZE  (80 * 50)
+static uint16_t         s_nearTextBuf[NEAR_TEXT_BUF_SIZE];
+#else
+#define TEXT_BUF_FAR        __far
+#endif
+
+/** Copy n words from the text buffer to VRAM.
+ */
+#if defined(CONS_USE_NEAR_TEXT_BUF) && defined(__WATCOMC__)
+void vramCopyWords(uint16_t __far* dst, uint16_t const* src, unsigned n);
+#pragma aux vramCopyWords =     \
+    "rep movsw"                 \
+    parm [es di] [si] [cx]      \
+    modify [di si cx]
+#elif defined(CONS_USE_NEAR_TEXT_BUF) && defined(__ia16__)
+static inline void vramCopyWords(uint16_t __far* dst, uint16_t const* src, unsigned n) {
+    uint16_t seg = FAR_PTR_SEG(dst);
+    uint16_t off = FAR_PTR_OFF(dst);
+    __asm__ volatile ("push %%es\n\tmov %3, %%es\n\tcld\n\trep movsw\n\tpop %%es"
+                      : "+D"(off), "+S"(src), "+c"(n) : "r"(seg) : "memory");
+}
+#else
+#define vramCopyWords(d,s,n)    _fmemcpy((d), (s), (n) * sizeof(uint16_t))
 #endif
 
 cons_clock_t _cons_PRIVATE_clock;
@@ -57,22 +95,33 @@ typedef struct CursorInfo {
 static CursorInfo s_cursorInfo;
 
 static uint16_t __far* s_textVram = NULL;
-static uint16_t __far* s_textBuf  = NULL;
+static uint16_t TEXT_BUF_FAR* s_textBuf = NULL;
+static uint16_t __far* s_textVramBase = NULL;   ///< Page 0.
+static unsigned        s_pageWords;             ///< Words per page. 0:no page flip.
+static uint8_t         s_drawPage;              ///< Hidden page to draw.
 
 static cons_clock_t s_start_clock;
 static uint8_t  s_saveVideoMode;
 static uint8_t  s_curVideoMode;
+static bool     s_scanLinesChanged;
+static bool     s_atexit_set;
 static int      s_textVramW;
 static int      s_textVramH;
 static int      s_textBufW = 80;
 static int      s_textBufH = 25;
 static char     s_cons_sprintf_buf[CONS_PRINTF_BUF_SIZE];
 
-typedef struct cons_rect_t {
-    cons_pos_t  x, y;
-    cons_pos_t  w, h;
-} cons_rect_t;
-static cons_rect_t  s_refresh_rect[CONS_REFRESH_RECT_N];
+/** The screen. Cells are s_textBuf. Dirty spans are filled by cons_puts/cons_clear
+ *  and consumed by consRefresh.
+ */
+#define DIRTY_ROWS_MAX  64
+static cons_cbuf_t      s_screen;
+
+/** Spans written in the last frame. With page flip, the hidden page lacks these.
+ */
+static uint8_t  s_prev_x0[DIRTY_ROWS_MAX];
+static uint8_t  s_prev_x1[DIRTY_ROWS_MAX];
+static bool     s_prev_all;
 
 /** Get video mode
  */
@@ -137,19 +186,124 @@ static int getScreenWidth() {
 static int getScreenHeight() {
     union REGS regs;
     regs.w.ax = 0x1130;
+    regs.h.bh = 0x00;
+    regs.h.dl = 25 - 1;     // Unchanged on CGA/MDA.
+    int86(0x10, &regs, &regs);
+    return regs.h.dl + 1;   // dl = rows - 1.
+}
+
+/** Set display page.
+ */
+static void setActivePage(uint8_t page) {
+    union REGS regs;
+    regs.h.ah = 0x05;
+    regs.h.al = page;
+    int86(0x10, &regs, &regs);
+}
+
+/** Get display page.
+ */
+static uint8_t getActivePage() {
+    union REGS regs;
+    regs.h.ah = 0x0F;
+    int86(0x10, &regs, &regs);
+    return regs.h.bh;
+}
+
+/** Bytes per page. (BIOS data 0040:004C)
+ */
+static unsigned getPageBytes() {
+    return *(uint16_t __far*)MK_FAR_PTR(0x40, 0x4C);
+}
+
+/** Is VGA present?
+ */
+static bool isVga() {
+    union REGS regs;
+    regs.w.ax = 0x1A00;
+    int86(0x10, &regs, &regs);
+    return regs.h.al == 0x1A;
+}
+
+/** Is EGA (or later) present?
+ */
+static bool isEga() {
+    union REGS regs;
+    regs.h.ah = 0x12;
+    regs.h.bl = 0x10;
+    int86(0x10, &regs, &regs);
+    return regs.h.bl != 0x10;
+}
+
+/** Select VGA scan lines for the next mode set. 0:200 1:350 2:400
+ */
+static void setScanLines(uint8_t n) {
+    union REGS regs;
+    regs.h.ah = 0x12;
+    regs.h.al = n;
+    regs.h.bl = 0x30;
+    int86(0x10, &regs, &regs);
+}
+
+/** Load the 8x8 ROM font. 43 rows at 350 lines, 50 rows at 400 lines.
+ */
+static void loadFont8x8() {
+    union REGS regs;
+    regs.w.ax = 0x1112;
+    regs.h.bl = 0x00;
+    int86(0x10, &regs, &regs);
+}
+
+/** Set VESA video mode.
+ *  @return 1:ok 0:not supported.
+ */
+static bool setVesaMode(uint16_t mode) {
+    union REGS regs;
+    regs.w.ax = 0x4F02;
+    regs.w.bx = mode;
     int86(0x10, &regs, &regs);
-    return regs.h.dl;
+    return regs.w.ax == 0x004F;
+}
+
+/** Set text mode from cons_init flags.
+ */
+static void setTextMode(unsigned flags) {
+    if (flags & (CONS_INIT_W132 | CONS_INIT_H60)) {
+        uint16_t mode;
+        if (flags & CONS_INIT_W132) {
+            mode = (flags & CONS_INIT_H60) ? 0x10C      // 132x60
+                 : (flags & CONS_INIT_H50) ? 0x10B      // 132x50
+                 : (flags & CONS_INIT_H43) ? 0x10A      // 132x43
+                 :                           0x109;     // 132x25
+        } else {
+            mode = 0x108;                               // 80x60
+        }
+        if (setVesaMode(mode))
+            return;
+        if (flags & CONS_INIT_H60)
+            flags |= CONS_INIT_H50;
+    }
+    s_curVideoMode = (flags & CONS_INIT_W40) ? 0x01 : 0x03;
+    if ((flags & (CONS_INIT_H43 | CONS_INIT_H50)) && isEga()) {
+        if (isVga()) {
+            setScanLines((flags & CONS_INIT_H50) ? 2 : 1);
+            s_scanLinesChanged = 1;
+        }
+        setVideoMode(s_curVideoMode);
+        loadFont8x8();
+    } else {
+        setVideoMode(s_curVideoMode);
+    }
 }
 
 static void updateWidthHeight() {
     s_textVramW = getScreenWidth();
     s_textVramH = getScreenHeight();
+    _cons_PRIVATE_screen_width  = (s_textVramW < s_textBufW) ? s_textVramW : s_textBufW;
+    _cons_PRIVATE_screen_height = (s_textVramH < s_textBufH) ? s_textVramH : s_textBufH;
     if (sizeof(cons_pos_t) == 1) {
-        _cons_PRIVATE_screen_width  = (s_textVramW >= 127) ? 127 : s_textVramW;
-        _cons_PRIVATE_screen_height = (s_textVramH >= 127) ? 127 : s_textVramH;
-    } else {
-        _cons_PRIVATE_screen_width  = s_textVramW;
-        _cons_PRIVATE_screen_height = s_textVramH;
+        if (_cons_PRIVATE_screen_width  >= 127) _cons_PRIVATE_screen_width  = 127;
+        if (_cons_PRIVATE_screen_height >= 127) _cons_PRIVATE_screen_height = 127;
     }
 }
 
@@ -181,6 +335,112 @@ static uint16_t getCh() {
     return regs.h.al;
 }
 
+#if defined(CONS_USE_KEY_INTR)
+
+/** Keyboard events from INT 9.  bit8:E0 prefix  bit7:break  bit6-0:scan code.
+ */
+#define KEY_RING_N  32  // power of 2.
+static uint16_t volatile    s_key_ring[KEY_RING_N];
+static uint8_t  volatile    s_key_ring_w;
+static uint8_t  volatile    s_key_ring_r;
+static uint8_t  volatile    s_key_e0;
+static uint8_t  volatile    s_key_held[256 / 8];    ///< bit (E0 << 7 | scan code).
+static void (__interrupt __far *s_key_handler_old)(void) = NULL;
+
+/** Scan code set 1 -> ascii. [0]:normal [1]:shift
+ */
+static char const s_key_ascii[2][0x3A] = {
+    "\0\033" "1234567890-=\b\t" "qwertyuiop[]\r\0" "asdfghjkl;'`\0\\" "zxcvbnm,./\0*\0 ",
+    "\0\033" "!@#$%^&*()_+\b\t" "QWERTYUIOP{}\r\0" "ASDFGHJKL:\"~\0|"  "ZXCVBNM<>?\0*\0 ",
+};
+
+#define key_isHeld(i)   ((s_key_held[(i) >> 3] >> ((i) & 7)) & 1)
+
+/** INT 9 handler. Push make/break codes to the ring, then chain to the old
+ *  handler. It acknowledges the key, keeps the BIOS shift states and handles
+ *  Ctrl+Break and Ctrl+Alt+Del. The keys it buffers are dropped by key_ringGet().
+ */
+static void __interrupt __far key_handler(void) {
+    uint8_t  sc = inp(0x60);
+    unsigned i;
+    if (sc == 0xE0 || sc == 0xE1) {
+        s_key_e0 = 1;
+    } else {
+        i = (s_key_e0 << 7) | (sc & 0x7f);
+        if (sc & 0x80)
+            s_key_held[i >> 3] &= ~(1 << (i & 7));
+        else
+            s_key_held[i >> 3] |=  (1 << (i & 7));
+        if (((s_key_ring_w + 1) & (KEY_RING_N - 1)) != s_key_ring_r) {
+            s_key_ring[s_key_ring_w] = (s_key_e0 << 8) | sc;
+            s_key_ring_w = (s_key_ring_w + 1) & (KEY_RING_N - 1);
+        }
+        s_key_e0 = 0;
+    }
+    _chain_intr(s_key_handler_old);
+}
+
+/** Install the INT 9 handler.
+ */
+static void key_intrInit(void) {
+    s_key_ring_r = s_key_ring_w = 0;
+    s_key_e0     = 0;
+    memset((void*)s_key_held, 0, sizeof(s_key_held));
+    s_key_handler_old = _dos_getvect(0x09);
+    _dos_setvect(0x09, key_handler);
+}
+
+/** Restore the INT 9 handler.
+ */
+static void key_intrTerm(void) {
+    if (s_key_handler_old) {
+        _disable();
+        _dos_setvect(0x09, s_key_handler_old);
+        _enable();
+        s_key_handler_old = NULL;
+    }
+}
+
+/** Event code -> cons_key_t. CONS_KEY_ERR for shift, ctrl, alt and lock keys.
+ */
+static cons_key_t key_fromCode(unsigned code, bool shift) {
+    unsigned sc = code & 0x7f;
+    if (sc == 0x1D || sc == 0x2A || sc == 0x36 || sc == 0x38)
+        return CONS_KEY_ERR;
+    if (code & 0x100)
+        return 0xE000 | sc;
+    if (sc == 0x3A || sc == 0x45 || sc == 0x46)
+        return CONS_KEY_ERR;
+    if (sc < 0x3A && s_key_ascii[shift][sc])
+        return (uint8_t)s_key_ascii[shift][sc];
+    return 0xE000 | sc;
+}
+
+/** Pop one key press from the ring.
+ *  The BIOS buffer is emptied through DOS, which also checks Ctrl+C and Ctrl+Break.
+ */
+static cons_key_t key_ringGet(void) {
+    uint16_t   code;
+    cons_key_t k;
+    while (kbHit())
+        getCh();
+    while (s_key_ring_r != s_key_ring_w) {
+        code = s_key_ring[s_key_ring_r];
+        s_key_ring_r = (s_key_ring_r + 1) & (KEY_RING_N - 1);
+        if (code & 0x80)    // break.
+            continue;
+        k = key_fromCode(code, key_isHeld(0x2A) || key_isHeld(0x36));
+        if (k != CONS_KEY_ERR)
+            return k;
+    }
+    return CONS_KEY_ERR;
+}
+
+#else
+#define key_intrInit()
+#define key_intrTerm()
+#endif  // CONS_USE_KEY_INTR
+
 #if 0 //!defined __FLAT__
 static uint16_t __far* getTextVramAddr(void) {
     union  REGS  regs;
@@ -213,54 +473,87 @@ static void consRefresh() {
 }
 #endif
 
-/** Screen refresh.
+/** Start page flip if two pages fit in the 32KB text VRAM.
+ */
+static void pageFlipInit(void) {
+    unsigned bytes = getPageBytes();
+    s_pageWords = 0;
+    if (bytes < s_textVramW * s_textVramH * sizeof(uint16_t) || bytes > 0x4000)
+        return;
+    setActivePage(1);
+    if (getActivePage() != 1) {
+        setActivePage(0);
+        return;
+    }
+    setActivePage(0);
+    s_pageWords = bytes / sizeof(uint16_t);
+    s_drawPage  = 1;
+    s_textVram  = s_textVramBase + s_pageWords;
+    s_prev_all  = 1;
+}
+
+/** Stop page flip. Draw to page 0 again.
+ */
+static void pageFlipTerm(void) {
+    if (s_pageWords) {
+        setActivePage(0);
+        s_pageWords = 0;
+        s_textVram  = s_textVramBase;
+    }
+}
+
+/** Show the drawn page. The other page becomes the hidden one.
+ */
+static void pageFlip(void) {
+    setActivePage(s_drawPage);
+    s_drawPage ^= 1;
+    s_textVram  = s_textVramBase + (s_drawPage ? s_pageWords : 0);
+}
+
+/** Add the spans of the last frame, which the hidden page lacks,
+ *  and keep the spans of this frame for the next one.
+ */
+static void pageMergeDirty(void) {
+    unsigned y, x0, x1;
+    bool     all = s_screen.dirty_all;
+    for (y = 0; y < s_textBufH; ++y) {
+        x0 = s_prev_x0[y];
+        x1 = s_prev_x1[y];
+        s_prev_x0[y] = (uint8_t)s_screen.dirty_x0[y];
+        s_prev_x1[y] = (uint8_t)s_screen.dirty_x1[y];
+        cons_cbufMarkDirty(&s_screen, y, x0, x1);
+    }
+    s_screen.dirty_all |= s_prev_all;
+    s_prev_all          = all;
+}
+
+/** Screen refresh. Copy only the dirty spans of each row.
  */
 static void consRefresh(void) {
-    cons_rect_t const* rt = &s_refresh_rect[0];
+    unsigned y, x0, x1, w, h;
     updateWidthHeight();
-    if (rt->w==s_textBufW && rt->h==s_textBufH && rt->x==0 && rt->y==0
-        && s_textVramW == s_textBufW && s_textVramH == s_textBufH
-    ) {
-        _fmemcpy(s_textVram, s_textBuf, s_textBufW * s_textBufH * sizeof(uint16_t));
+    if (s_pageWords)
+        pageMergeDirty();
+    if (s_screen.dirty_all && s_textVramW == s_textBufW && s_textVramH == s_textBufH) {
+        vramCopyWords(s_textVram, s_textBuf, s_textBufW * s_textBufH);
+        _cons_PRIVATE_statsAdd(cells_changed, (unsigned)(s_textBufW * s_textBufH));
+        _cons_PRIVATE_statsAdd(out_units, (unsigned)(s_textBufW * s_textBufH));
     } else {
-        cons_rect_t const* rt_e = &s_refresh_rect[CONS_REFRESH_RECT_N];
-        do {
-            unsigned    n, bytes, dofs, sofs;
-            cons_pos_t  x,y,w,h;
-            x  = rt->x;
-            w  = rt->w;
-            if (x <= 0) {
-                w += x;
-                x = 0;
-                if (w <= 0)
-                    continue;
-            } else if (x + w > s_textBufW) {
-                w = s_textBufW - x;
-                if (w <= 0)
-                    continue;
-            }
-            y  = rt->y;
-            h  = rt->h;
-            if (y <= 0) {
-                h += y;
-                y = 0;
-                if (h <= 0)
-                    continue;
-            } else if (y + h > s_textBufH) {
-                h = s_textBufH - y;
-                if (h <= 0)
-                    continue;
-            }
-            bytes = w * sizeof(uint16_t);
-            sofs  = y * s_textBufW  + x;
-            dofs  = y * s_textVramW + x;
-            for (n = 0; n < h; ++n) {
-                _fmemcpy(&s_textVram[dofs], &s_textBuf[sofs], bytes);
-                sofs += s_textBufW;
-                dofs += s_textVramW;
-            }
-        } while (++rt < rt_e);
+        w = (s_textBufW < s_textVramW) ? s_textBufW : s_textVramW;
+        h = (s_textBufH < s_textVramH) ? s_textBufH : s_textVramH;
+        for (y = s_screen.dirty_y0; y < (unsigned)s_screen.dirty_y1 && y < h; ++y) {
+            x0 = s_screen.dirty_x0[y];
+            x1 = s_screen.dirty_x1[y];
+            if (x1 > w)
+                x1 = w;
+            if (x0 >= x1)
+                continue;
+            vramCopyWords(&s_textVram[y * s_textVramW + x0], &s_textBuf[y * s_textBufW + x0], x1 - x0);
+            _cons_PRIVATE_statsAdd(cells_changed, x1 - x0);
+            _cons_PRIVATE_statsAdd(out_units, x1 - x0);
+        }
     }
+    cons_cbufClean(&s_screen);
 }
 
 /** vblank start wait.
@@ -271,30 +564,188 @@ static void vsyncWait(void) {
     while ((inp(vga_status_port) & 0x08) == 0) { }
 }
 
+#if defined(CONS_USE_PIT_INTR)
+
+#define PIT_HZ          1193182UL
+#define PIT_RATE        1000U                               // Interrupts per second.
+#define PIT_DIVISOR     ((uint16_t)(PIT_HZ / PIT_RATE))     // 1193
+
+static volatile uint32_t s_pit_count;   ///< milli-seconds.
+static volatile uint16_t s_pit_chain;   ///< Carries out every 65536 PIT clocks (18.2Hz).
+static void (__interrupt __far *s_pit_handler_old)(void) = NULL;
+
+/** PIT channel 0 rate. 0 is 65536 (18.2Hz, BIOS default).
+ */
+static void pit_setDivisor(uint16_t d) {
+    outp(0x43, 0x36);   // channel 0, lo/hi byte, mode 3.
+    outp(0x40, (uint8_t)d);
+    outp(0x40, (uint8_t)(d >> 8));
+}
+
+/** INT 8 handler. Chain to the original handler at 18.2Hz.
+ */
+static void __interrupt __far pit_handler(void) {
+    ++s_pit_count;
+    s_pit_chain += PIT_DIVISOR;
+    if (s_pit_chain < PIT_DIVISOR)
+        _chain_intr(s_pit_handler_old);
+    outp(0x20, 0x20);   // EOI.
+}
+
+/** Start 1ms timer.
+ */
+static void pit_init(void) {
+    if (s_pit_handler_old)
+        return;
+    s_pit_count = 0;
+    s_pit_chain = 0;
+    s_pit_handler_old = _dos_getvect(0x08);
+    _disable();
+    _dos_setvect(0x08, pit_handler);
+    pit_setDivisor(PIT_DIVISOR);
+    _enable();
+}
+
+/** Restore PIT and INT 8.
+ */
+static void pit_term(void) {
+    if (s_pit_handler_old) {
+        _disable();
+        pit_setDivisor(0);
+        _dos_setvect(0x08, s_pit_handler_old);
+        _enable();
+        s_pit_handler_old = NULL;
+    }
+}
+
+#else
+#define pit_init()
+#define pit_term()
+#endif  // CONS_USE_PIT_INTR
+
+/** Restore hooked interrupts on exit() or Ctrl-C without cons_term.
+ */
+static void consAtExit(void) {
+    pit_term();
+    key_intrTerm();
+}
+
+static void consSignal(int sig) {
+    (void)sig;
+    exit(1);
+}
+
+static cons_clock_t getCurrentTimer(void);
+
+#if defined(CONS_USE_PIT_INTR) || defined(__DJGPP__)
+#define USE_FINE_TIMER              // getCurrentTimer() is fine enough to tell a late frame.
+#endif
+
+#if defined(USE_FINE_TIMER)
+static cons_clock_t  s_frame_clock;         ///< Clock at the last present.
+static unsigned      s_frame_period = 14;   ///< Milli-seconds per refresh. Measured in cons_init.
+#endif
+static unsigned long s_frame_overrun;       ///< Number of late frames.
+
+/** Is the display in vblank now?
+ */
+static bool inVblank(void) {
+    return (inp(0x03DA) & 0x08) != 0;
+}
+
+#if defined(USE_FINE_TIMER)
+/** Measure the refresh period.
+ */
+static void vsyncMeasure(void) {
+    cons_clock_t t;
+    unsigned     i;
+    vsyncWait();
+    t = getCurrentTimer();
+    for (i = 0; i < 8; ++i)
+        vsyncWait();
+    s_frame_period  = (unsigned)((getCurrentTimer() - t) / 8);
+    if (s_frame_period == 0)
+        s_frame_period = 1;
+    s_frame_clock   = getCurrentTimer();
+    s_frame_overrun = 0;
+}
+#else
+#define vsyncMeasure()      ((void)0)
+#endif
+
+/** Before copying to the shown page: wait for the next vblank, unless one was already missed or it is vblank now.
+ *  Without USE_FINE_TIMER a 55ms clock can not tell a late frame; only vblank is checked.
+ */
+static void vsyncPresentWait(void) {
+    if (cons_replayMode() == CONS_REPLAY_PLAY)
+        return;
+ #if defined(USE_FINE_TIMER)
+    if (getCurrentTimer() - s_frame_clock > s_frame_period)
+        ++s_frame_overrun;  // Late. Waiting would cost almost one more refresh.
+    else if (!inVblank())
+        vsyncWait();
+    s_frame_clock = getCurrentTimer();
+ #else
+    if (!inVblank())
+        vsyncWait();
+ #endif
+}
+
+/** Wait for the vblank that latches the start address set by pageFlip().
+ *  Always waits, even when late or in vblank; without the latch the next frame
+ *  would be written to the page still on screen. A late frame is only counted.
+ */
+static void vsyncFlipWait(void) {
+    if (cons_replayMode() == CONS_REPLAY_PLAY)
+        return;
+ #if defined(USE_FINE_TIMER)
+    if (getCurrentTimer() - s_frame_clock > s_frame_period)
+        ++s_frame_overrun;
+ #endif
+    vsyncWait();
+ #if defined(USE_FINE_TIMER)
+    s_frame_clock = getCurrentTimer();
+ #endif
+}
+
 static cons_clock_t getCurrentTimer(void) {
- #if defined __DJGPP__
+ #if defined(CONS_USE_PIT_INTR)
+    cons_clock_t c;
+    _disable();
+    c = s_pit_count;
+    _enable();
+    return c;
+ #elif defined __DJGPP__
     return (cons_clock_t)(uclock() * CONS_CLOCK_PER_SEC / UCLOCKS_PER_SEC);
  #else
     return (cons_clock_t)(clock() * CONS_CLOCK_PER_SEC / CLOCKS_PER_SEC);
  #endif
 }
 
+/** Micro seconds for cons_stats. As fine as getCurrentTimer().
+ */
+unsigned long _cons_PRIVATE_statsUsec(void) {
+    return getCurrentTimer() * (1000000UL / CONS_CLOCK_PER_SEC);
+}
+
 // ================================================================
 
 /** Initialize.
+ *  @param flags    CONS_INIT_W40, CONS_INIT_H43, ... The buffer is sized from the mode actually set.
  */
 int cons_init(unsigned flags) {
+ #if defined(CONS_USE_NEAR_TEXT_BUF)
+    if (flags & CONS_INIT_H60)                  // Step down to the modes the buffer holds.
+        flags |= CONS_INIT_H50;
+    flags &= ~(CONS_INIT_W132 | CONS_INIT_H60);
+ #endif
     s_saveVideoMode = getVideoMode();
-    if (flags & 1)  // text 40x25
-        s_curVideoMode  = 0x01;
-    else            // text 80x25
-        s_curVideoMode  = 0x03;
-    s_textBufW = (s_curVideoMode <= 1) ? 40 : 80;
-    setVideoMode(s_curVideoMode);
+    setTextMode(flags);
 
     getCursorInfo(&s_cursorInfo);
  #if 1 //defined __FLAT__
     s_textVram      = (uint16_t __far*)MK_FAR_PTR(0xB800,0x0000);
+    s_textVramBase  = s_textVram;
  #else
     s_dosv          = 1;
     s_textVram      = getTextVramAddr();
@@ -304,17 +755,47 @@ int cons_init(unsigned flags) {
     }
  #endif
     updateWidthHeight();
-    if (!s_textBuf) {
-        size_t bytes = s_textBufW * s_textBufH * sizeof(uint16_t);
-        s_textBuf    = (uint16_t __far*)_fmalloc(bytes);
+    s_textBufW = (s_textVramW > 255) ? 255 : s_textVramW;
+    s_textBufH = (s_textVramH > DIRTY_ROWS_MAX) ? DIRTY_ROWS_MAX : s_textVramH;
+ #if defined(CONS_USE_NEAR_TEXT_BUF)
+    if (s_textBufW > 80)
+        s_textBufW = 80;
+    if (s_textBufH > NEAR_TEXT_BUF_SIZE / s_textBufW)
+        s_textBufH = NEAR_TEXT_BUF_SIZE / s_textBufW;
+    s_textBuf = s_nearTextBuf;
+ #else
+    s_textBuf = NULL;
+ #endif
+    cons_cbufTerm(&s_screen);
+    if (!cons_cbufInit(&s_screen, s_textBufW, s_textBufH, s_textBuf)) {
+        setVideoMode(s_saveVideoMode);
+        return 0;
     }
+ #if !defined(CONS_USE_NEAR_TEXT_BUF)
+    s_textBuf = s_screen.cells;
+ #endif
+    updateWidthHeight();
+    if (flags & CONS_INIT_PAGE_FLIP)
+        pageFlipInit();
     _cons_PRIVATE_col   = CONS_COL_DEFAULT; // white
     setBlinkMode(0);
     hideCursor();
-    cons_setRefreshRect(0, 0,0, s_textBufW, s_textBufH);
     cons_clear();
     consRefresh();
+    if (!s_atexit_set) {
+        s_atexit_set = 1;
+        atexit(consAtExit);
+        signal(SIGINT, consSignal);
+     #if defined(SIGBREAK)
+        signal(SIGBREAK, consSignal);
+     #endif
+    }
+    key_intrInit();
+    pit_init();
+    if (cons_replayMode() != CONS_REPLAY_PLAY)
+        vsyncMeasure();
     s_start_clock = getCurrentTimer();
+    cons_statsReset();
 
     return 1;
 }
@@ -322,13 +803,20 @@ int cons_init(unsigned flags) {
 /** Terminate.
  */
 void cons_term(void) {
-    cons_setRefreshRect(0, 0,0, s_textBufW, s_textBufH);
+    cons_replayClose();
+    pit_term();
+    key_intrTerm();
+    pageFlipTerm();
     cons_clear();
     consRefresh();
     if (s_cursorInfo.cursorVisible)
         showCursor(&s_cursorInfo);
-    _ffree(s_textBuf);
+    cons_cbufTerm(&s_screen);
     s_textBuf = NULL;
+    if (s_scanLinesChanged) {
+        setScanLines(2);
+        s_scanLinesChanged = 0;
+    }
     setVideoMode(s_saveVideoMode);
 }
 
@@ -336,8 +824,12 @@ void cons_term(void) {
  */
 void cons_updateBegin(void) {
     cons_key_t   k;
+    _cons_PRIVATE_statsBegin();
     _cons_PRIVATE_clock  = getCurrentTimer() - s_start_clock;
     _cons_PRIVATE_tick   = _cons_PRIVATE_clock * 60 / CONS_CLOCK_PER_SEC;
+ #if defined(CONS_USE_KEY_INTR)
+    k = key_ringGet();
+ #else
     if (kbHit()) {
         do {
             k = getCh();
@@ -345,52 +837,126 @@ void cons_updateBegin(void) {
     } else {
         k = CONS_KEY_ERR;
     }
+ #endif
     _cons_PRIVATE_key = k;
-    cons_setRefreshRect(0, 0,0, s_textBufW, s_textBufH);
+    _cons_PRIVATE_replayFrame(&_cons_PRIVATE_clock, &_cons_PRIVATE_tick, &_cons_PRIVATE_key);
+    _cons_PRIVATE_statsBegun(&_cons_PRIVATE_key);
+}
+
+/** Is the key held down now?
+ *  Without CONS_USE_KEY_INTR, only the key of this frame.
+ */
+int cons_keyHeld(cons_key_t key) {
+ #if defined(CONS_USE_KEY_INTR)
+    unsigned i, code;
+    if (cons_replayMode() == CONS_REPLAY_PLAY)
+        return key == _cons_PRIVATE_key;
+    for (i = 0; i < 256; ++i) {
+        if (s_key_held[i >> 3] == 0) {
+            i |= 7;
+            continue;
+        }
+        if (key_isHeld(i)) {
+            code = ((i & 0x80) << 1) | (i & 0x7f);
+            if (key_fromCode(code, 0) == key || key_fromCode(code, 1) == key)
+                return 1;
+        }
+    }
+    return 0;
+ #else
+    return key == _cons_PRIVATE_key;
+ #endif
 }
 
 /**
  */
 void cons_updateEnd(void) {
-    vsyncWait();
-    consRefresh();
+    _cons_PRIVATE_statsEnd();
+    if (s_pageWords) {
+        consRefresh();      // to the hidden page.
+        pageFlip();
+        vsyncFlipWait();    // The new start address is latched at vblank.
+    } else {
+        vsyncPresentWait();
+        consRefresh();
+    }
+    _cons_PRIVATE_statsEnded();
+}
+
+/** Number of frames that missed their vblank since cons_init.
+ *  Games can compare it with the previous value and draw less.
+ *  Counted only with CONS_USE_PIT_INTR or DJGPP.
+ */
+unsigned long cons_frameOverrun(void) {
+    return s_frame_overrun;
 }
 
 /** Set screen refresh rect.
+ *  Kept for compatibility. Written cells are tracked automatically,
+ *  so this only forces the rect to be copied on the next refresh.
  */
 void cons_setRefreshRect(uint8_t no, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h) {
-    cons_rect_t* rt = &s_refresh_rect[no];
+    int i;
     assert(no < CONS_REFRESH_RECT_N);
-    rt->x = x;
-    rt->y = y;
-    rt->w = w;
-    rt->h = h;
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > s_textBufW) w = s_textBufW - x;
+    if (y + h > s_textBufH) h = s_textBufH - y;
+    if (w <= 0)
+        return;
+    for (i = 0; i < h; ++i)
+        cons_cbufMarkDirty(&s_screen, y + i, x, x + w);
 }
 
 /** Screen clear.
  */
 void cons_clear(void) {
-    unsigned x, y;
-    uint16_t offset = 0;
     uint16_t co     = 7; //_cons_PRIVATE_col;
 
     updateWidthHeight();
-    for (y = 0; y < s_textBufH; ++y) {
-        for (x = 0; x < s_textBufW; ++x) {
-            s_textBuf[offset++] = (co << 8) | ' ';
-        }
-    }
+    cons_cbufFill(&s_screen, 0, 0, s_textBufW, s_textBufH, (co << 8) | ' ');
     cons_setxy(0, 0);
 }
 
-/** Set color
+/** cons color to VGA attribute.
  */
-void cons_setcolor(uint8_t co) {
+static uint8_t colToAttr(uint8_t co) {
     static uint8_t const tbl[] = { 0,1,4,5,2,3,6,7,8,9,12,13,10,11,14,15 };
     uint8_t co2 = tbl[co&15];
     if (co & 0x10)
         co2 = (co2 << 4); // & 0x7f;
-    _cons_PRIVATE_col = co2;
+    return co2;
+}
+
+/** Set color
+ */
+void cons_setcolor(uint8_t co) {
+    _cons_PRIVATE_col = colToAttr(co);
+}
+
+/** Make a cell of character ch (CP437) and color co.
+ */
+cons_cell_t cons_makeCell(unsigned ch, cons_col_t co) {
+    return (cons_cell_t)((colToAttr(co) << 8) | (ch & 0xff));
+}
+
+/** The screen buffer. Valid between cons_init and cons_term.
+ */
+cons_cbuf_t* cons_screen(void) {
+    return &s_screen;
+}
+
+/** Copy str to cells without color. Used by cons_glyphRegister().
+ *  @return number of cells. 0 when str is "" or does not fit in max cells.
+ */
+unsigned cons_encodeCells(cons_cell_t* d, char const* str, unsigned max) {
+    unsigned n;
+    for (n = 0; str[n]; ++n) {
+        if (n >= max)
+            return 0;
+        d[n] = (uint8_t)str[n];
+    }
+    return n;
 }
 
 /** Put string.
@@ -398,11 +964,15 @@ void cons_setcolor(uint8_t co) {
 void cons_puts(char const* s) {
     uint16_t offset = (_cons_PRIVATE_cur_y * s_textBufW + _cons_PRIVATE_cur_x);
     uint16_t co     = _cons_PRIVATE_col;
+    unsigned x0     = _cons_PRIVATE_cur_x;
+    char const* s0  = s;
     while (*s) {
         s_textBuf[offset] = (co << 8) | *(uint8_t const*)s;
         ++s;
         ++offset;
         if (++_cons_PRIVATE_cur_x >= s_textBufW) {
+            cons_cbufMarkDirty(&s_screen, _cons_PRIVATE_cur_y, x0, s_textBufW);
+            x0 = 0;
             _cons_PRIVATE_cur_x = 0;
             if (++_cons_PRIVATE_cur_y >= s_textBufH) {
                 _cons_PRIVATE_cur_y = 0;
@@ -410,6 +980,8 @@ void cons_puts(char const* s) {
             offset = (_cons_PRIVATE_cur_y * s_textBufW);
         }
     }
+    cons_cbufMarkDirty(&s_screen, _cons_PRIVATE_cur_y, x0, _cons_PRIVATE_cur_x);
+    _cons_PRIVATE_statsAdd(cells_put, (unsigned)(s - s0));
 }
 
 /** Set position(x,y) and put string.
@@ -422,6 +994,7 @@ void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* s) {
 /** Set position(x,y), set color and put string.
  */
 void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t c, char const* s) {
+    _cons_PRIVATE_statsAdd(puts_calls, 1);
     cons_setxy(x,y);
     cons_setcolor(c);
     cons_puts(s);
@@ -4,6 +4,14 @@
  *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
  *  @date   2024-12
  *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Options in cons_pcat.c, off by default (Open Watcom):
+ *   CONS_USE_KEY_INTR  Own INT 9 handler. Gives cons_keyHeld() for all keys.
+ *   CONS_USE_PIT_INTR  Reprograms PIT channel 0 to 1kHz and hooks INT 8.
+ *                      cons_clock() is then 1ms instead of 55ms (DJGPP: uclock()),
+ *                      and a late frame is detected to skip its vblank wait.
+ *   CONS_USE_NEAR_TEXT_BUF  16bit: the text buffer in DGROUP, copied with rep movsw.
+ *                      Up to 80x50; CONS_INIT_W132 is ignored and CONS_INIT_H60 is 50 rows.
  */
 #ifndef CONS_PCAT_H__
 #define CONS_PCAT_H__
@@ -12,6 +20,14 @@
 
 //#define CONS_USE_TEXT_W40
 
+// cons_init flags.
+#define CONS_INIT_W40           0x01    ///< 40 columns.
+#define CONS_INIT_H43           0x02    ///< 43 rows. (EGA/VGA 8x8 font or VESA)
+#define CONS_INIT_H50           0x04    ///< 50 rows. (VGA 8x8 font or VESA. 43 rows on EGA)
+#define CONS_INIT_H60           0x08    ///< 60 rows. (VESA. Falls back to 50 rows)
+#define CONS_INIT_W132          0x10    ///< 132 columns. (VESA. Falls back to 80 columns)
+#define CONS_INIT_PAGE_FLIP     0x20    ///< Draw to the hidden page and flip at vblank.
+
 #define CONS_KEY_NONE           0
 #define CONS_KEY_DOWN           0xE050
 #define CONS_KEY_UP             0xE048
@@ -21,6 +37,7 @@
 #define CONS_KEY_ESC            0x1B
 #define CONS_KEY_SPACE          0x20
 #define CONS_KEY_ERR            0xFFFF
+#define CONS_KEY_STATS          0xE044  ///< F10. Toggles the stats overlay.
 
 #define CONS_COL_DEFAULT        7
 #define CONS_COL_BLACK          0
@@ -60,12 +77,17 @@
 #define CONS_MSEC_TO_TICK(ms)   ((ms) * CONS_TICK_PER_SEC / 1000)
 
 typedef unsigned long  cons_clock_t;
-typedef signed char    cons_pos_t;
+typedef short          cons_pos_t;
 typedef unsigned char  cons_col_t;
 typedef unsigned short cons_key_t;
+typedef char const*    cons_enc_t;
+typedef unsigned short cons_cell_t;     ///< char | (VGA attribute << 8). The text VRAM format.
 
 int  cons_init(unsigned flags);
 void cons_term(void);
+int  cons_keyHeld(cons_key_t key);
+unsigned long cons_frameOverrun(void);
+#define cons_wakeAt(clk)    ((void)0)   // Only the server schedules frames.
 
 void cons_updateBegin(void);
 void cons_updateEnd(void);
@@ -76,6 +98,11 @@ void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* msg);
 void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t col, char const* msg);
 void cons_setcolor(cons_col_t co);
 
+// Strings are written as is. No pre-encoding needed.
+#define cons_encode(s)                  (s)
+#define cons_encodeFree(e)
+#define cons_xycputEncoded(x,y,c,e)     cons_xycputs((x),(y),(c),(e))
+
 #if 1 // private name.
     extern cons_clock_t _cons_PRIVATE_clock;
     extern cons_clock_t _cons_PRIVATE_tick;
@@ -107,4 +134,12 @@ void cons_setcolor(cons_col_t co);
 #define CONS_REFRESH_RECT_N     4
 void cons_setRefreshRect(unsigned char n, cons_pos_t x, cons_pos_t y, cons_pos_t w, cons_pos_t h);
 
+#include "cons_cell.h"
+#include "cons_attr.h"
+#include "cons_glyph.h"
+#include "cons_replay.h"
+#include "cons_stats.h"
+#include "cons_trace.h"
+#include "cons_surface.h"
+
 #endif //CONS_DOS_H__
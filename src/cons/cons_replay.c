@@ -0,0 +1,143 @@
+/**
+ *  @file cons_replay.c
+ *  @brief Input recording and playback for cons.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   File format:
+ *     "CRPL" version(1byte) varint(seed)
+ *     frame: varint(clock delta) varint(tick delta << 1 | has_key) [varint(key)]
+ */
+#include "cons.h"
+#include <stdio.h>
+#include <string.h>
+
+#define REPLAY_MAGIC        "CRPL"
+#define REPLAY_VERSION      1
+
+static FILE*        s_replay_fp;
+static int          s_replay_mode;
+static int          s_replay_end;
+static cons_clock_t s_replay_clock;
+static cons_clock_t s_replay_tick;
+
+/** Write varint.
+ */
+static void replay_putVar(cons_clock_t v) {
+    while (v >= 0x80) {
+        putc((int)(v & 0x7f) | 0x80, s_replay_fp);
+        v >>= 7;
+    }
+    putc((int)v, s_replay_fp);
+}
+
+/** Read varint.
+ *  @return 0:end of file.
+ */
+static int replay_getVar(cons_clock_t* v) {
+    cons_clock_t n = 0;
+    unsigned     sh = 0;
+    int          c;
+    do {
+        c = getc(s_replay_fp);
+        if (c == EOF || sh >= sizeof(n) * 8)
+            return 0;
+        n |= (cons_clock_t)(c & 0x7f) << sh;
+        sh += 7;
+    } while (c & 0x80);
+    *v = n;
+    return 1;
+}
+
+/** Start recording or playback.
+ *  Call before cons_init().
+ *  @return seed to pass to srand(). The recorded one when playing back.
+ */
+unsigned long cons_replayOpen(int mode, char const* path, unsigned long seed) {
+    char         magic[4];
+    cons_clock_t v;
+    cons_replayClose();
+    if (mode == CONS_REPLAY_RECORD) {
+        s_replay_fp = fopen(path, "wb");
+        if (!s_replay_fp)
+            return seed;
+        fwrite(REPLAY_MAGIC, 1, 4, s_replay_fp);
+        putc(REPLAY_VERSION, s_replay_fp);
+        replay_putVar(seed);
+    } else if (mode == CONS_REPLAY_PLAY) {
+        s_replay_fp = fopen(path, "rb");
+        if (!s_replay_fp)
+            return seed;
+        if (fread(magic, 1, 4, s_replay_fp) != 4 || memcmp(magic, REPLAY_MAGIC, 4)
+            || getc(s_replay_fp) != REPLAY_VERSION || !replay_getVar(&v)
+        ) {
+            fclose(s_replay_fp);
+            s_replay_fp = NULL;
+            return seed;
+        }
+        seed = (unsigned long)v;
+    } else {
+        return seed;
+    }
+    s_replay_mode  = mode;
+    s_replay_end   = 0;
+    s_replay_clock = 0;
+    s_replay_tick  = 0;
+    return seed;
+}
+
+/** Stop recording or playback.
+ */
+void cons_replayClose(void) {
+    if (s_replay_fp)
+        fclose(s_replay_fp);
+    s_replay_fp   = NULL;
+    s_replay_mode = CONS_REPLAY_OFF;
+}
+
+/** CONS_REPLAY_OFF, CONS_REPLAY_RECORD or CONS_REPLAY_PLAY.
+ */
+int cons_replayMode(void) {
+    return s_replay_mode;
+}
+
+/** Has playback reached the end of the log?
+ */
+int cons_replayEnd(void) {
+    return s_replay_end;
+}
+
+/** Record or replace this frame's clock, tick and key.
+ *  Called at the end of cons_updateBegin().
+ */
+void _cons_PRIVATE_replayFrame(cons_clock_t* clock, cons_clock_t* tick, cons_key_t* key) {
+    cons_clock_t dc, dt, k;
+    if (s_replay_mode == CONS_REPLAY_RECORD) {
+        dc = *clock - s_replay_clock;
+        dt = *tick  - s_replay_tick;
+        s_replay_clock = *clock;
+        s_replay_tick  = *tick;
+        replay_putVar(dc);
+        if (*key == CONS_KEY_ERR) {
+            replay_putVar(dt << 1);
+        } else {
+            replay_putVar((dt << 1) | 1);
+            replay_putVar(*key);
+        }
+    } else if (s_replay_mode == CONS_REPLAY_PLAY) {
+        k = CONS_KEY_ERR;
+        if (!replay_getVar(&dc) || !replay_getVar(&dt)
+            || ((dt & 1) && !replay_getVar(&k))
+        ) {
+            s_replay_end = 1;
+            dc = dt = 0;
+            k  = CONS_KEY_ERR;
+        }
+        s_replay_clock += dc;
+        s_replay_tick  += dt >> 1;
+        *clock = s_replay_clock;
+        *tick  = s_replay_tick;
+        *key   = (cons_key_t)k;
+    }
+}
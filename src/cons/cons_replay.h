@@ -0,0 +1,27 @@
+/**
+ *  @file cons_replay.h
+ *  @brief Input recording and playback for cons.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Included from the backend header. Records cons_clock(), cons_tick() and
+ *   cons_key() of every frame as delta-encoded varints.
+ */
+#ifndef CONS_REPLAY_H__
+#define CONS_REPLAY_H__
+
+#define CONS_REPLAY_OFF         0   ///< Not recording / playing.
+#define CONS_REPLAY_RECORD      1   ///< Recording.
+#define CONS_REPLAY_PLAY        2   ///< Playing back. No real-time wait.
+
+unsigned long cons_replayOpen(int mode, char const* path, unsigned long seed);
+void cons_replayClose(void);
+int  cons_replayMode(void);
+int  cons_replayEnd(void);
+
+#if 1 // private name.
+    void _cons_PRIVATE_replayFrame(cons_clock_t* clock, cons_clock_t* tick, cons_key_t* key);
+#endif
+
+#endif //CONS_REPLAY_H__
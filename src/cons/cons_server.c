@@ -0,0 +1,665 @@
+/**
+ *  @file cons_server.c
+ *  @brief A console screen library serving many terminals over sockets from one process.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   One thread. epoll waits for connections, input and writable sockets.
+ *   The next frame of each session is kept in a timer wheel of 1 msec slots.
+ *   A session runs a frame when a key arrives or at its wake time, which is
+ *   CONS_SERVER_FRAME_MSEC later than the last frame or earlier by cons_wakeAt().
+ *   The screen of a session is diffed with a shadow of its terminal and
+ *   written as ANSI sequences. While the bytes of the last frame are not sent,
+ *   no more are made: a slow terminal gets the newest screen when it is ready.
+ */
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE     // accept4
+#endif
+#include "cons.h"
+#include "cons_text.h"
+#include "cons_ansi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#define SRV_KEY_RING        16              ///< Keys kept per session. Power of 2.
+#define SRV_WHEEL_SIZE      256             ///< Slots of the timer wheel. Power of 2.
+#define SRV_EVENTS          256             ///< epoll events per wait.
+#define SRV_READ_SIZE       512
+#define SRV_SB_SIZE         8               ///< Bytes of a telnet sub negotiation kept.
+#define SRV_CSI_SIZE        12              ///< Bytes of a control sequence kept. Enough for a DECRQM reply.
+#define SRV_DEFAULT_HOST    "127.0.0.1"
+
+// telnet
+#define TN_SE               240
+#define TN_SB               250
+#define TN_WILL             251
+#define TN_DONT             254
+#define TN_IAC              255
+#define TN_ECHO             1
+#define TN_SGA              3
+#define TN_NAWS             31
+
+/// Input parser states.
+enum { IN_NORMAL, IN_CR, IN_IAC, IN_IAC_OPT, IN_SB, IN_SB_IAC, IN_ESC, IN_CSI };
+
+/** A connection.
+ */
+typedef struct cons_session_t {
+    cons_text_t             text;           ///< Screen and drawing state.
+    cons_cbuf_t             shadow;         ///< What the terminal shows.
+    cons_ansi_t             ansi;           ///< Bytes to the terminal.
+    cons_statsState_t       stats;
+    cons_pace_t             pace;           ///< Kernel send queue of fd.
+    int                     fd;
+    int                     telnet;         ///< Talk telnet. (TCP)
+    int                     want_out;       ///< EPOLLOUT is on.
+    cons_clock_t            start;          ///< Server clock of the connection.
+    cons_clock_t            clock;
+    cons_clock_t            tick;
+    cons_clock_t            wake;           ///< Server clock of the next frame.
+    cons_key_t              key;
+    cons_key_t              keys[SRV_KEY_RING];
+    unsigned                key_r;
+    unsigned                key_w;
+    unsigned char           in_state;
+    unsigned char           sb_len;
+    unsigned char           sb[SRV_SB_SIZE];
+    unsigned char           csi_len;
+    char                    csi[SRV_CSI_SIZE];
+    struct cons_session_t*  next;           ///< Timer wheel slot list.
+    struct cons_session_t*  prev;
+    void*                   st;             ///< Game state. Follows this struct.
+} cons_session_t;
+
+static cons_serverApp_t const*  s_app;
+static unsigned                 s_flags;            ///< cons_init flags of the sessions.
+static int                      s_epoll     = -1;
+static int                      s_listen    = -1;
+static cons_session_t*          s_cur;              ///< Session of the frame.
+static cons_session_t*          s_wheel[SRV_WHEEL_SIZE];
+static cons_clock_t             s_wheelNow;         ///< Slots before this time are done.
+static unsigned                 s_sessionNum;
+static volatile sig_atomic_t    s_quit;
+
+/** Micro seconds for cons_stats.
+ */
+unsigned long _cons_PRIVATE_statsUsec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)ts.tv_sec * 1000000UL + (unsigned long)(ts.tv_nsec / 1000);
+}
+
+/** Server clock. msec.
+ */
+static cons_clock_t srv_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (cons_clock_t)ts.tv_sec * 1000U + (cons_clock_t)(ts.tv_nsec / 1000000);
+}
+
+static void srv_onSignal(int sig) {
+    (void)sig;
+    s_quit = 1;
+}
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  timer wheel
+
+/** Put s in the slot of s->wake.
+ */
+static void wheel_add(cons_session_t* s) {
+    cons_session_t** slot;
+    if (s->wake < s_wheelNow)
+        s->wake = s_wheelNow;
+    slot    = &s_wheel[s->wake & (SRV_WHEEL_SIZE - 1)];
+    s->prev = NULL;
+    s->next = *slot;
+    if (*slot)
+        (*slot)->prev = s;
+    *slot = s;
+}
+
+/** Remove s from its slot.
+ */
+static void wheel_del(cons_session_t* s) {
+    if (s->prev)
+        s->prev->next = s->next;
+    else if (s_wheel[s->wake & (SRV_WHEEL_SIZE - 1)] == s)
+        s_wheel[s->wake & (SRV_WHEEL_SIZE - 1)] = s->next;
+    if (s->next)
+        s->next->prev = s->prev;
+    s->next = s->prev = NULL;
+}
+
+/** Move s to wake time t.
+ */
+static void wheel_move(cons_session_t* s, cons_clock_t t) {
+    wheel_del(s);
+    s->wake = t;
+    wheel_add(s);
+}
+
+/** Take the sessions to wake by now off the wheel.
+ *  @return list linked by next.
+ */
+static cons_session_t* wheel_expire(cons_clock_t now) {
+    cons_session_t* due = NULL;
+    cons_session_t* s;
+    cons_session_t* nx;
+    cons_clock_t    n;
+    if (now < s_wheelNow)
+        return NULL;
+    n = now - s_wheelNow + 1;
+    if (n > SRV_WHEEL_SIZE)
+        n = SRV_WHEEL_SIZE;
+    for (; n; --n, ++s_wheelNow) {
+        for (s = s_wheel[s_wheelNow & (SRV_WHEEL_SIZE - 1)]; s; s = nx) {
+            nx = s->next;
+            if (s->wake <= now) {
+                wheel_del(s);
+                s->next = due;
+                due     = s;
+            }
+        }
+    }
+    s_wheelNow = now + 1;
+    return due;
+}
+
+/** msec until the first slot with a session. -1 when there is none.
+ */
+static int wheel_timeout(cons_clock_t now) {
+    unsigned i;
+    for (i = 0; i < SRV_WHEEL_SIZE; ++i) {
+        if (s_wheel[(s_wheelNow + i) & (SRV_WHEEL_SIZE - 1)])
+            return (s_wheelNow + i > now) ? (int)(s_wheelNow + i - now) : 0;
+    }
+    return s_sessionNum ? SRV_WHEEL_SIZE : -1;
+}
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  session
+
+/** Set epoll events of s.
+ */
+static void srv_watch(cons_session_t* s, int want_out) {
+    struct epoll_event ev;
+    if (s->want_out == want_out)
+        return;
+    s->want_out = want_out;
+    ev.events   = EPOLLIN | (want_out ? EPOLLOUT : 0);
+    ev.data.ptr = s;
+    epoll_ctl(s_epoll, EPOLL_CTL_MOD, s->fd, &ev);
+}
+
+/** Send what can be sent now.
+ *  @return 0:the connection is broken.
+ */
+static int srv_flush(cons_session_t* s) {
+    ssize_t n;
+    while (s->ansi.len) {
+        n = send(s->fd, s->ansi.buf, s->ansi.len, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            return 0;
+        }
+        cons_ansiConsume(&s->ansi, (unsigned)n);
+    }
+    srv_watch(s, s->ansi.len != 0);
+    return !s->ansi.err;
+}
+
+/** Resize the screen of s to the terminal. Repaint all.
+ */
+static int srv_resize(cons_session_t* s, unsigned w, unsigned h) {
+    if (w < 1)    w = 1;
+    if (h < 1)    h = 1;
+    if (w > 1000) w = 1000;
+    if (h > 1000) h = 1000;
+    cons_cbufTerm(&s->shadow);
+    if (!_cons_PRIVATE_textResize(&s->text, (cons_pos_t)w, (cons_pos_t)h)
+        || !cons_cbufInit(&s->shadow, (cons_pos_t)w, (cons_pos_t)h, NULL))
+        return 0;
+    cons_ansiReset(&s->ansi, &s->shadow);
+    return 1;
+}
+
+/** Make s the current session.
+ */
+static void srv_select(cons_session_t* s) {
+    static cons_statsState_t s_noStats;     // Counts out of the sessions. Not shown.
+    s_cur               = s;
+    _cons_PRIVATE_text  = s ? &s->text : NULL;
+    _cons_PRIVATE_stats = s ? &s->stats : &s_noStats;
+}
+
+static void srv_close(cons_session_t* s) {
+    static char const bye[] = "\x1b[0m\x1b[?25h\x1b[H\x1b[2J";
+    srv_select(s);
+    if (s_app->term)
+        s_app->term(s->st);
+    srv_select(NULL);
+    send(s->fd, bye, sizeof(bye) - 1, MSG_NOSIGNAL | MSG_DONTWAIT);
+    wheel_del(s);
+    epoll_ctl(s_epoll, EPOLL_CTL_DEL, s->fd, NULL);
+    close(s->fd);
+    cons_ansiTerm(&s->ansi);
+    cons_cbufTerm(&s->shadow);
+    cons_cbufTerm(&s->text.screen);
+    free(s);
+    --s_sessionNum;
+}
+
+/** Run one frame of s.
+ *  @return 0:s is closed.
+ */
+static int srv_frame(cons_session_t* s) {
+    int rc;
+    srv_select(s);
+    cons_updateBegin();
+    rc = s_app->frame(s->st);
+    cons_updateEnd();
+    srv_select(NULL);
+    if (!rc || !srv_flush(s)) {
+        srv_close(s);
+        return 0;
+    }
+    _cons_PRIVATE_paceSent(&s->pace, s->fd, _cons_PRIVATE_statsUsec());    // Never blocks.
+    if (s->key_r != s->key_w)   // More keys. Next frame as soon as possible.
+        s->wake = 0;
+    wheel_add(s);
+    return 1;
+}
+
+static void srv_pushKey(cons_session_t* s, cons_key_t k) {
+    if (s->key_w - s->key_r < SRV_KEY_RING)
+        s->keys[s->key_w++ & (SRV_KEY_RING - 1)] = k;
+}
+
+/** End of a telnet sub negotiation.
+ */
+static int srv_subNego(cons_session_t* s) {
+    if (s->sb_len >= 5 && s->sb[0] == TN_NAWS)
+        return srv_resize(s, (s->sb[1] << 8) | s->sb[2], (s->sb[3] << 8) | s->sb[4]);
+    return 1;
+}
+
+/** Parse input bytes to keys. Telnet commands and cursor key sequences are handled here.
+ *  @return 0:out of memory.
+ */
+static int srv_input(cons_session_t* s, unsigned char const* p, unsigned n) {
+    unsigned i;
+    unsigned c;
+    for (i = 0; i < n; ++i) {
+        c = p[i];
+        switch (s->in_state) {
+        case IN_CR:         // CR LF, CR NUL are one return.
+            s->in_state = IN_NORMAL;
+            if (c == '\n' || c == 0)
+                break;
+            // fall through
+        case IN_NORMAL:
+            if (c == TN_IAC && s->telnet) {
+                s->in_state = IN_IAC;
+            } else if (c == 0x1b) {
+                s->in_state = IN_ESC;
+            } else if (c == '\r') {
+                srv_pushKey(s, CONS_KEY_RETURN);
+                s->in_state = IN_CR;
+            } else if (c == '\n') {
+                srv_pushKey(s, CONS_KEY_RETURN);
+            } else if (c) {
+                srv_pushKey(s, (cons_key_t)c);
+            }
+            break;
+        case IN_IAC:
+            if (c >= TN_WILL && c <= TN_DONT) {
+                s->in_state = IN_IAC_OPT;
+            } else if (c == TN_SB) {
+                s->sb_len   = 0;
+                s->in_state = IN_SB;
+            } else {
+                s->in_state = IN_NORMAL;
+            }
+            break;
+        case IN_IAC_OPT:
+            s->in_state = IN_NORMAL;
+            break;
+        case IN_SB:
+            if (c == TN_IAC)
+                s->in_state = IN_SB_IAC;
+            else if (s->sb_len < SRV_SB_SIZE)
+                s->sb[s->sb_len++] = (unsigned char)c;
+            break;
+        case IN_SB_IAC:
+            if (c == TN_IAC) {          // Escaped 255.
+                if (s->sb_len < SRV_SB_SIZE)
+                    s->sb[s->sb_len++] = (unsigned char)c;
+                s->in_state = IN_SB;
+            } else {
+                s->in_state = IN_NORMAL;
+                if (c == TN_SE && !srv_subNego(s))
+                    return 0;
+            }
+            break;
+        case IN_ESC:
+            if (c == '[' || c == 'O') {
+                s->csi_len  = 0;
+                s->in_state = IN_CSI;
+            } else {
+                srv_pushKey(s, CONS_KEY_ESC);
+                s->in_state = IN_NORMAL;
+                --i;
+            }
+            break;
+        case IN_CSI:
+            if (s->csi_len < SRV_CSI_SIZE)
+                s->csi[s->csi_len++] = (char)c;
+            if (c >= 0x40 && c <= 0x7e) {   // Final byte.
+                if (c == 'y')      cons_ansiSyncReply(&s->ansi, s->csi, s->csi_len);
+                else if (c == 'A')      srv_pushKey(s, CONS_KEY_UP);
+                else if (c == 'B') srv_pushKey(s, CONS_KEY_DOWN);
+                else if (c == 'C') srv_pushKey(s, CONS_KEY_RIGHT);
+                else if (c == 'D') srv_pushKey(s, CONS_KEY_LEFT);
+                s->in_state = IN_NORMAL;
+            }
+            break;
+        }
+    }
+    if (s->in_state == IN_ESC) {    // ESC alone in a packet is the ESC key.
+        srv_pushKey(s, CONS_KEY_ESC);
+        s->in_state = IN_NORMAL;
+    }
+    return 1;
+}
+
+/** Read input of s. Run a frame at once when a key came.
+ */
+static void srv_read(cons_session_t* s) {
+    unsigned char buf[SRV_READ_SIZE];
+    ssize_t       n;
+    for (;;) {
+        n = recv(s->fd, buf, sizeof buf, 0);
+        if (n > 0) {
+            if (!srv_input(s, buf, (unsigned)n)) {
+                srv_close(s);
+                return;
+            }
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        srv_close(s);       // EOF or error.
+        return;
+    }
+    if (s->key_r != s->key_w && s->wake > s_wheelNow)
+        wheel_move(s, s_wheelNow);
+}
+
+/** Accept all pending connections.
+ */
+static void srv_accept(void) {
+    static unsigned char const nego[] = {
+        TN_IAC, TN_WILL, TN_ECHO, TN_IAC, TN_WILL, TN_SGA, TN_IAC, 253 /*DO*/, TN_NAWS,
+    };
+    struct sockaddr_storage sa;
+    struct epoll_event      ev;
+    socklen_t               len;
+    cons_session_t*         s;
+    int                     fd, one = 1;
+    for (;;) {
+        len = sizeof sa;
+        fd  = accept4(s_listen, (struct sockaddr*)&sa, &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            return;     // EAGAIN, or out of fds. Try again at the next event.
+        }
+        s = (cons_session_t*)calloc(1, sizeof(cons_session_t) + s_app->state_size);
+        if (!s) {
+            close(fd);
+            continue;
+        }
+        s->fd     = fd;
+        s->st     = s + 1;
+        s->telnet = (sa.ss_family != AF_UNIX);
+        s->start  = srv_now();
+        s->wake   = s->start;
+        s->text.ambiWide = (s_flags & CONS_INIT_AMBI_WIDE) != 0;
+        cons_ansiInit(&s->ansi);
+        ev.events   = EPOLLIN;
+        ev.data.ptr = s;
+        if (!srv_resize(s, 80, 24) || epoll_ctl(s_epoll, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            cons_ansiTerm(&s->ansi);
+            cons_cbufTerm(&s->shadow);
+            cons_cbufTerm(&s->text.screen);
+            free(s);
+            close(fd);
+            continue;
+        }
+        if (s->telnet) {
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof one);
+            cons_ansiWrite(&s->ansi, (char const*)nego, sizeof nego);
+        }
+        cons_ansiWrite(&s->ansi, CONS_ANSI_SYNC_QUERY, sizeof(CONS_ANSI_SYNC_QUERY) - 1);
+        ++s_sessionNum;
+        srv_select(s);
+        if (s_app->init)
+            s_app->init(s->st);
+        srv_select(NULL);
+        wheel_add(s);
+    }
+}
+
+/** Open the listening socket.
+ *  @param addr "unix:path", "host:port" or "port".
+ */
+static int srv_listen(char const* addr) {
+    struct addrinfo  hints;
+    struct addrinfo* res = NULL;
+    char             host[256];
+    char const*      port;
+    int              fd, one = 1;
+    if (strncmp(addr, "unix:", 5) == 0) {
+        struct sockaddr_un un;
+        memset(&un, 0, sizeof un);
+        un.sun_family = AF_UNIX;
+        strncpy(un.sun_path, addr + 5, sizeof(un.sun_path) - 1);
+        unlink(un.sun_path);
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0 || bind(fd, (struct sockaddr*)&un, sizeof un) < 0 || listen(fd, SOMAXCONN) < 0) {
+            if (fd >= 0)
+                close(fd);
+            return -1;
+        }
+        return fd;
+    }
+    port = strrchr(addr, ':');
+    if (port) {
+        size_t l = (size_t)(port - addr);
+        if (l >= sizeof host)
+            l = sizeof host - 1;
+        memcpy(host, addr, l);
+        host[l] = 0;
+        ++port;
+    } else {
+        strcpy(host, SRV_DEFAULT_HOST);
+        port = addr;
+    }
+    memset(&hints, 0, sizeof hints);
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = AI_PASSIVE;
+    if (getaddrinfo(host[0] ? host : NULL, port, &hints, &res) != 0 || !res)
+        return -1;
+    fd = socket(res->ai_family, res->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, res->ai_protocol);
+    if (fd >= 0) {
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof one);
+        if (bind(fd, res->ai_addr, res->ai_addrlen) < 0 || listen(fd, SOMAXCONN) < 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(res);
+    return fd;
+}
+
+/** Serve the game on addr until SIGINT or SIGTERM.
+ *  @param addr     "unix:path", "host:port" or "port". (host is 127.0.0.1 by default)
+ *  @param flags    cons_init flags of every session. Only CONS_INIT_AMBI_WIDE is used.
+ *  @return 0:ok 1:error.
+ */
+int cons_serverMain(char const* addr, unsigned flags, cons_serverApp_t const* app) {
+    struct epoll_event  evs[SRV_EVENTS];
+    struct epoll_event  ev;
+    struct rlimit       rl;
+    cons_session_t*     s;
+    cons_session_t*     due;
+    unsigned            i;
+    int                 n;
+
+    s_app   = app;
+    s_flags = flags;
+    if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_cur < rl.rlim_max) {
+        rl.rlim_cur = rl.rlim_max;      // One fd per session.
+        setrlimit(RLIMIT_NOFILE, &rl);
+    }
+    s_listen = srv_listen(addr);
+    if (s_listen < 0) {
+        fprintf(stderr, "cons: can't listen on %s\n", addr);
+        return 1;
+    }
+    s_epoll = epoll_create1(EPOLL_CLOEXEC);
+    ev.events   = EPOLLIN;
+    ev.data.ptr = NULL;
+    if (s_epoll < 0 || epoll_ctl(s_epoll, EPOLL_CTL_ADD, s_listen, &ev) < 0) {
+        close(s_listen);
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT,  srv_onSignal);
+    signal(SIGTERM, srv_onSignal);
+    s_wheelNow = srv_now();
+
+    while (!s_quit) {
+        n = epoll_wait(s_epoll, evs, SRV_EVENTS, wheel_timeout(srv_now()));
+        for (i = 0; (int)i < n; ++i) {
+            s = (cons_session_t*)evs[i].data.ptr;
+            if (!s) {
+                srv_accept();
+            } else if (evs[i].events & (EPOLLERR | EPOLLHUP)) {
+                srv_close(s);
+            } else {
+                if ((evs[i].events & EPOLLOUT) && !srv_flush(s)) {
+                    srv_close(s);
+                    continue;
+                }
+                if (evs[i].events & EPOLLIN)
+                    srv_read(s);
+            }
+        }
+        for (due = wheel_expire(srv_now()); (s = due) != NULL; ) {
+            due = s->next;
+            s->next = NULL;
+            srv_frame(s);
+        }
+    }
+
+    for (i = 0; i < SRV_WHEEL_SIZE; ++i) {
+        while (s_wheel[i])
+            srv_close(s_wheel[i]);
+    }
+    close(s_epoll);
+    close(s_listen);
+    if (strncmp(addr, "unix:", 5) == 0)
+        unlink(addr + 5);
+    s_epoll = s_listen = -1;
+    return 0;
+}
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  cons API on the current session.
+
+/** The sessions are made by cons_serverMain(). Only the flags are taken.
+ */
+int cons_init(unsigned flags) {
+    if (s_cur)
+        s_cur->text.ambiWide = (flags & CONS_INIT_AMBI_WIDE) != 0;
+    cons_statsReset();
+    return 1;
+}
+
+void cons_term(void) {
+}
+
+/** Ask for the next frame no later than clk. (clock of the session)
+ */
+void cons_wakeAt(cons_clock_t clk) {
+    if (s_cur && s_cur->start + clk < s_cur->wake)
+        s_cur->wake = s_cur->start + clk;
+}
+
+void cons_updateBegin(void) {
+    cons_session_t* s   = s_cur;
+    cons_clock_t    now;
+    _cons_PRIVATE_statsBegin();
+    now      = srv_now();
+    s->clock = now - s->start;
+    s->tick  = s->clock * CONS_TICK_PER_SEC / CONS_CLOCK_PER_SEC;
+    s->key   = (s->key_r != s->key_w) ? s->keys[s->key_r++ & (SRV_KEY_RING - 1)] : CONS_KEY_ERR;
+    s->wake  = now + CONS_MSEC_TO_CLOCK(CONS_SERVER_FRAME_MSEC);
+    _cons_PRIVATE_statsBegun(&s->key);
+}
+
+void cons_updateEnd(void) {
+    cons_session_t* s = s_cur;
+    _cons_PRIVATE_statsEnd();
+    // Else the terminal is behind. Keep the dirty spans for later.
+    if (s->ansi.len != 0) {
+        _cons_PRIVATE_statsAdd(deferred, 1);
+    } else if (_cons_PRIVATE_paceReady(&s->pace, s->fd)) {
+        cons_ansiPresent(&s->ansi, &s->text.screen, &s->shadow);
+        _cons_PRIVATE_statsAdd(out_units, s->ansi.len);
+    }
+    _cons_PRIVATE_statsEnded();
+}
+
+cons_clock_t cons_clock(void) {
+    return s_cur->clock;
+}
+
+cons_clock_t cons_tick(void) {
+    return s_cur->tick;
+}
+
+cons_key_t cons_key(void) {
+    return s_cur->key;
+}
+
+cons_pos_t cons_screenWidth(void) {
+    return s_cur->text.screen.w;
+}
+
+cons_pos_t cons_screenHeight(void) {
+    return s_cur->text.screen.h;
+}
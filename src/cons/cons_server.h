@@ -0,0 +1,134 @@
+/**
+ *  @file cons_server.h
+ *  @brief A console screen library serving many terminals over sockets from one process.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Linux. Each connection is a session with its own screen, keys and clock.
+ *   The game does not run its own loop: cons_serverMain() calls the frame
+ *   function of a session between cons_updateBegin() and cons_updateEnd(),
+ *   with the cons functions drawing to that session.
+ *   TCP clients are talked to as telnet (window size by NAWS). Unix socket
+ *   clients are raw terminals: e.g. socat -,raw,echo=0 UNIX-CONNECT:path
+ *   Each terminal is asked for synchronized output (DECRQM 2026) when it
+ *   connects. Frames are wrapped in it when the terminal says it has it.
+ */
+#ifndef CONS_SERVER_H__
+#define CONS_SERVER_H__
+
+#define CONS_SERVER
+
+#define CONS_KEY_NONE           0
+#define CONS_KEY_ERR            0xffff
+#define CONS_KEY_DOWN           0x102
+#define CONS_KEY_UP             0x103
+#define CONS_KEY_LEFT           0x104
+#define CONS_KEY_RIGHT          0x105
+#define CONS_KEY_RETURN         0x0a
+#define CONS_KEY_ESC            0x1B
+#define CONS_KEY_SPACE          0x20
+#define CONS_KEY_STATS          0x14    ///< Ctrl-T. Toggles the stats overlay.
+
+#define CONS_COL_DEFAULT        0
+#define CONS_COL_BLACK          16
+#define CONS_COL_BLUE           1
+#define CONS_COL_RED            2
+#define CONS_COL_MAGENTA        3
+#define CONS_COL_GREEN          4
+#define CONS_COL_CYAN           5
+#define CONS_COL_YELLOW         6
+#define CONS_COL_WHITE          7
+
+#define CONS_COL_GRAY           8
+#define CONS_COL_L_BLUE         9
+#define CONS_COL_L_RED          10
+#define CONS_COL_L_MAGENTA      11
+#define CONS_COL_L_GREEN        12
+#define CONS_COL_L_CYAN         13
+#define CONS_COL_L_YELLOW       14
+#define CONS_COL_L_WHITE        15
+
+#define CONS_COL_LIGHT          8
+#define CONS_COL_BACK_LIGHT     8
+#define CONS_COL_REVERSE        0x10
+
+#ifndef CONS_PRINTF_BUF_SIZE
+#define CONS_PRINTF_BUF_SIZE    1024
+#endif
+
+#define CONS_CLOCK_PER_SEC      1000U
+#define CONS_CLOCK_TO_MSEC(tm)  (tm) //((tm) * 1000 / CONS_CLOCK_PER_SEC)
+#define CONS_MSEC_TO_CLOCK(ms)  (ms) //((ms)*CONS_CLOCK_PER_SEC / 1000)
+#define CONS_TICK_PER_SEC       60U
+#define CONS_TICK_TO_MSEC(tm)   ((tm) * 1000 / CONS_TICK_PER_SEC)
+#define CONS_MSEC_TO_TICK(ms)   ((ms) * CONS_TICK_PER_SEC / 1000)
+
+#ifndef CONS_SERVER_FRAME_MSEC
+#define CONS_SERVER_FRAME_MSEC  50      ///< Frame interval of a session without input.
+#endif
+
+typedef unsigned long long cons_clock_t;
+typedef short          cons_pos_t;
+typedef unsigned char  cons_col_t;
+typedef unsigned short cons_key_t;
+typedef unsigned int   cons_cell_t;     ///< (color << 24) | unicode code point.
+typedef cons_cell_t const* cons_enc_t;
+
+#define CONS_INIT_AMBI_WIDE     0x40    ///< East Asian Ambiguous characters are 2 columns.
+
+/** Callbacks of the game. Called with the session as the current one.
+ */
+typedef struct cons_serverApp_t {
+    unsigned    state_size;             ///< Bytes of the game state of a session.
+    void      (*init)(void* st);        ///< Connected. st is zero filled.
+    int       (*frame)(void* st);       ///< One frame: update and draw. 0:close the session.
+    void      (*term)(void* st);        ///< Disconnected.
+} cons_serverApp_t;
+
+int  cons_serverMain(char const* addr, unsigned flags, cons_serverApp_t const* app);
+void cons_wakeAt(cons_clock_t clk);
+
+int  cons_init(unsigned flags);
+void cons_term(void);
+
+void cons_updateBegin(void);
+void cons_updateEnd(void);
+
+cons_clock_t cons_clock(void);
+cons_clock_t cons_tick(void);
+cons_key_t   cons_key(void);
+#define cons_keyHeld(k)     ((k) == cons_key())     // No key-held state on terminals.
+#define cons_frameOverrun() 0UL                     // No vblank on terminals.
+cons_pos_t   cons_screenWidth(void);
+cons_pos_t   cons_screenHeight(void);
+
+void cons_clear(void);
+
+void cons_setxy(cons_pos_t x, cons_pos_t y);
+void cons_setcolor(cons_col_t col);
+void cons_resetcolor(cons_col_t col);
+
+void cons_puts(char const* msg);
+void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* msg);
+void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t col, char const* msg);
+
+cons_enc_t cons_encode(char const* msg);
+void cons_encodeFree(cons_enc_t e);
+void cons_xycputEncoded(cons_pos_t x, cons_pos_t y, cons_col_t col, cons_enc_t e);
+
+void cons_printf(char const* fmt, ...);
+void cons_xyprintf(cons_pos_t x, cons_pos_t y, char const* fmt, ...);
+void cons_xycprintf(cons_pos_t x, cons_pos_t y, cons_col_t col, char const* fmt, ...);
+
+#define cons_setRefreshRect(n,x,y,w,h)  ((void)0)
+
+#include "cons_cell.h"
+#include "cons_attr.h"
+#include "cons_glyph.h"
+#include "cons_replay.h"
+#include "cons_stats.h"
+#include "cons_trace.h"
+#include "cons_surface.h"
+
+#endif //CONS_SERVER_H__
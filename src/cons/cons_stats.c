@@ -0,0 +1,136 @@
+/**
+ *  @file cons_stats.c
+ *  @brief Per-frame counters of cons and their overlay line.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   The backend calls, in each frame:
+ *     cons_updateBegin: _cons_PRIVATE_statsBegin() ... _cons_PRIVATE_statsBegun(&key)
+ *     cons_updateEnd:   _cons_PRIVATE_statsEnd() ... present ... _cons_PRIVATE_statsEnded()
+ *   cells_put is counted by the writers (the cons_cbuf functions, cons_puts,
+ *   cons_blit) and cells_changed by cons_cbufDiff(). Marking cells dirty
+ *   without writing them, like cons_setRefreshRect(), is not counted. The backend adds out_units and puts_calls.
+ *   The same hooks record the frame events of cons_trace.
+ */
+#include "cons.h"
+#include <stdio.h>
+#include <string.h>
+
+static cons_statsState_t    s_stats;
+cons_statsState_t*          _cons_PRIVATE_stats = &s_stats;
+
+/** Counters of the last full window.
+ */
+cons_stats_t const* cons_stats(void) {
+    return &_cons_PRIVATE_stats->last;
+}
+
+/** Clear the counters and start a new window. Called by cons_init().
+ */
+void cons_statsReset(void) {
+    cons_statsState_t* st = _cons_PRIVATE_stats;
+    memset(&st->cur,  0, sizeof(st->cur));
+    memset(&st->last, 0, sizeof(st->last));
+    st->t_window = st->t_mark = _cons_PRIVATE_statsUsec();
+}
+
+/** Show or hide the overlay line. Also toggled by CONS_KEY_STATS.
+ */
+void cons_statsOverlay(int on) {
+    _cons_PRIVATE_stats->overlay = (on != 0);
+}
+
+/** Entering cons_updateBegin().
+ */
+void _cons_PRIVATE_statsBegin(void) {
+    unsigned long now = _cons_PRIVATE_statsUsec();
+    _cons_PRIVATE_stats->t_mark = now;
+    _cons_PRIVATE_traceEvent("frame", 'B', now);
+    _cons_PRIVATE_traceEvent("cons_updateBegin", 'B', now);
+}
+
+/** Leaving cons_updateBegin(). CONS_KEY_STATS is taken here.
+ */
+void _cons_PRIVATE_statsBegun(cons_key_t* key) {
+    cons_statsState_t* st  = _cons_PRIVATE_stats;
+    unsigned long      now = _cons_PRIVATE_statsUsec();
+    st->cur.begin_us += now - st->t_mark;
+    st->t_mark        = now;
+    _cons_PRIVATE_traceEvent("cons_updateBegin", 'E', now);
+    if (*key == CONS_KEY_STATS) {
+        st->overlay ^= 1;
+        *key = CONS_KEY_ERR;
+    }
+}
+
+/** Draw the averages of the last window on the bottom row.
+ *  The cells under it are kept in st->row.
+ */
+static void stats_drawOverlay(cons_statsState_t* st) {
+    cons_cbuf_t*        b = cons_screen();
+    cons_stats_t const* s = &st->last;
+    unsigned long       f = s->frames ? s->frames : 1;
+    unsigned long       ms = s->window_us / 1000;
+    char                buf[CONS_STATS_OVERLAY_W + 128];
+    cons_cell_t         cells[CONS_STATS_OVERLAY_W + 1];
+    unsigned            w, n;
+    if (!b || !b->cells)
+        return;
+    w = (b->w < CONS_STATS_OVERLAY_W) ? b->w : CONS_STATS_OVERLAY_W;
+    sprintf(buf, "%3lufps beg%6lu game%6lu pres%6lu us  put%5lu chg%5lu out%6lu puts%3lu",
+            ms ? s->frames * 1000 / ms : 0,
+            s->begin_us / f, s->game_us / f, s->present_us / f,
+            s->cells_put / f, s->cells_changed / f, s->out_units / f, s->puts_calls / f);
+    n = (unsigned)strlen(buf);
+    while (n < w)
+        buf[n++] = ' ';
+    buf[w] = '\0';
+    n = cons_encodeCells(cells, buf, w + 1);   // +1: curses keeps room for a wide character.
+    if (n > w)
+        n = w;
+    if (n == 0)
+        return;
+    cons_cbufGet(b, 0, b->h - 1, n, 1, st->row);
+    cons_cbufPutRow(b, 0, b->h - 1, cells, n, cons_makeCell(0, CONS_COL_REVERSE | CONS_COL_WHITE));
+    st->saved = (unsigned char)n;
+}
+
+/** Entering cons_updateEnd().
+ */
+void _cons_PRIVATE_statsEnd(void) {
+    cons_statsState_t* st  = _cons_PRIVATE_stats;
+    unsigned long      now = _cons_PRIVATE_statsUsec();
+    st->cur.game_us += now - st->t_mark;
+    st->t_mark       = now;
+    _cons_PRIVATE_traceEvent("cons_updateEnd", 'B', now);
+    st->put_mark     = st->cur.cells_put;
+    if (st->overlay)
+        stats_drawOverlay(st);
+}
+
+/** Leaving cons_updateEnd(). Puts back the cells under the overlay and closes the window.
+ */
+void _cons_PRIVATE_statsEnded(void) {
+    cons_statsState_t* st = _cons_PRIVATE_stats;
+    cons_cbuf_t*       b;
+    unsigned long      now;
+    if (st->saved) {
+        b = cons_screen();
+        cons_cbufPut(b, 0, b->h - 1, st->saved, 1, st->row);
+        st->saved = 0;
+    }
+    st->cur.cells_put = st->put_mark;   // Not the overlay.
+    now = _cons_PRIVATE_statsUsec();
+    st->cur.present_us += now - st->t_mark;
+    st->t_mark          = now;
+    _cons_PRIVATE_traceEvent("cons_updateEnd", 'E', now);
+    _cons_PRIVATE_traceEvent("frame", 'E', now);
+    ++st->cur.frames;
+    if (now - st->t_window >= CONS_STATS_WINDOW_US) {
+        st->last           = st->cur;
+        st->last.window_us = now - st->t_window;
+        memset(&st->cur, 0, sizeof(st->cur));
+        st->t_window       = now;
+    }
+}
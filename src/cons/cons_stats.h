@@ -0,0 +1,65 @@
+/**
+ *  @file cons_stats.h
+ *  @brief Per-frame counters of cons and their overlay line.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Included from the backend header after cons_cell.h.
+ *   The counters are summed over a window of about one second, then
+ *   cons_stats() returns the last full window. Divide by frames for the
+ *   average of a frame.
+ *   Times are in micro seconds, but only as fine as the backend clock:
+ *   1ms on PC-AT with CONS_USE_PIT_INTR (55ms without), 10ms or a vsync on PC-98.
+ *   CONS_KEY_STATS toggles an overlay of the averages on the bottom row.
+ *   The game does not get that key.
+ */
+#ifndef CONS_STATS_H__
+#define CONS_STATS_H__
+
+#define CONS_STATS_WINDOW_US    1000000UL   ///< Length of a window.
+#define CONS_STATS_OVERLAY_W    80          ///< Columns of the overlay line.
+
+/** Counters of one window.
+ */
+typedef struct cons_stats_t {
+    unsigned long   window_us;      ///< Length of the window.
+    unsigned long   frames;         ///< cons_updateEnd() calls.
+    unsigned long   begin_us;       ///< Time in cons_updateBegin(). With the input wait of curses.
+    unsigned long   game_us;        ///< Time from cons_updateBegin() to cons_updateEnd(). Game update and draw.
+    unsigned long   present_us;     ///< Time in cons_updateEnd(). With the vblank wait of DOS.
+    unsigned long   cells_put;      ///< Cells written to the screen or a surface. Not cells only marked dirty.
+    unsigned long   cells_changed;  ///< Cells sent to the screen. (PC-AT: cells in the dirty spans. PC-98: words of the busier plane.)
+    unsigned long   out_units;      ///< Bytes to the terminal (curses: to curses), or words to VRAM.
+    unsigned long   puts_calls;     ///< cons_xycputs() calls. cons_xycprintf() too.
+    unsigned long   deferred;       ///< Frames not presented because the terminal was behind.
+    unsigned long   pair_hits;      ///< curses: color changes that had a color pair.
+    unsigned long   pair_misses;    ///< curses: color changes that made a color pair by init_pair().
+} cons_stats_t;
+
+cons_stats_t const* cons_stats(void);
+void cons_statsReset(void);
+void cons_statsOverlay(int on);
+
+#if 1 // private name.
+    typedef struct cons_statsState_t {
+        cons_stats_t    cur;        ///< The window being counted.
+        cons_stats_t    last;       ///< The last full window.
+        unsigned long   t_window;   ///< Start of cur.
+        unsigned long   t_mark;     ///< Start of the current phase of the frame.
+        unsigned long   put_mark;   ///< cur.cells_put when the game finished drawing.
+        unsigned char   overlay;
+        unsigned char   saved;      ///< row[] holds the cells under the overlay.
+        cons_cell_t     row[CONS_STATS_OVERLAY_W];
+    } cons_statsState_t;
+
+    extern cons_statsState_t*   _cons_PRIVATE_stats;    ///< Counting goes here. The server switches it per session.
+    unsigned long _cons_PRIVATE_statsUsec(void);        ///< Implemented by the backend.
+    void _cons_PRIVATE_statsBegin(void);
+    void _cons_PRIVATE_statsBegun(cons_key_t* key);
+    void _cons_PRIVATE_statsEnd(void);
+    void _cons_PRIVATE_statsEnded(void);
+    #define _cons_PRIVATE_statsAdd(m,n) (_cons_PRIVATE_stats->cur.m += (n))
+#endif
+
+#endif //CONS_STATS_H__
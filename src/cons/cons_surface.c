@@ -0,0 +1,138 @@
+/**
+ *  @file cons_surface.c
+ *  @brief Off-screen cell buffers composited onto the screen.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ */
+#include "cons.h"
+#include <stdlib.h>
+#include <string.h>
+
+/** Initialize a w x h surface. All cells are CONS_CELL_NONE.
+ *  @return 0:out of memory.
+ */
+int cons_surfaceInit(cons_surface_t* s, cons_pos_t w, cons_pos_t h) {
+    s->solid = NULL;
+    if (!cons_cbufInit(&s->buf, w, h, NULL))
+        return 0;
+    s->solid = (unsigned char*)calloc(h, 1);
+    if (!s->solid) {
+        cons_cbufTerm(&s->buf);
+        return 0;
+    }
+    cons_surfaceClear(s);
+    return 1;
+}
+
+/** Release the surface. A zero filled surface may be released too.
+ */
+void cons_surfaceTerm(cons_surface_t* s) {
+    cons_cbufTerm(&s->buf);
+    free(s->solid);
+    s->solid = NULL;
+}
+
+/** Make all cells CONS_CELL_NONE.
+ */
+void cons_surfaceClear(cons_surface_t* s) {
+    cons_cbufFill(&s->buf, 0, 0, s->buf.w, s->buf.h, CONS_CELL_NONE);
+}
+
+/** Put a string at (x, y) with color col. One row, no wrap. Cells out of the surface are clipped.
+ */
+void cons_surfacePuts(cons_surface_t* s, cons_pos_t x, cons_pos_t y, cons_col_t col, char const* str) {
+    size_t       l = strlen(str);
+    cons_cell_t* c = (cons_cell_t*)malloc((l + 2) * sizeof(cons_cell_t));
+    unsigned     n;
+    if (!c)
+        return;
+    n = cons_encodeCells(c, str, (unsigned)l + 2);  // +2: curses keeps room for a wide character.
+    cons_cbufPutRow(&s->buf, x, y, c, n, cons_makeCell(0, col));
+    free(c);
+}
+
+/** Put a glyph at (x, y) with color col.
+ */
+void cons_surfacePutGlyph(cons_surface_t* s, cons_pos_t x, cons_pos_t y, cons_col_t col, cons_glyph_t id) {
+    cons_cbufPutGlyph(&s->buf, x, y, col, id);
+}
+
+/** Find again which dirty rows have no CONS_CELL_NONE, and mark the surface clean.
+ */
+static void surface_scan(cons_surface_t* s) {
+    cons_cbuf_t* b = &s->buf;
+    unsigned     o;
+    cons_pos_t   x, y;
+    for (y = b->dirty_y0; y < b->dirty_y1; ++y) {
+        if (b->dirty_x0[y] >= b->dirty_x1[y])
+            continue;
+        o = cons_cbufIndex(b, 0, y);
+        for (x = 0; x < b->w && cons_cbufCell(b, o + x) != CONS_CELL_NONE; ++x)
+            ;
+        s->solid[y] = (x == b->w);
+    }
+    cons_cbufClean(b);
+}
+
+/** Copy the rect of src to (x, y) of dst. CONS_CELL_NONE of src are not copied.
+ *  Only the cells that differ are written and marked dirty.
+ *  @param dst      destination surface, or NULL for the screen. Not src.
+ *  @param src      source surface. Its dirty rows are scanned again and cleaned.
+ *  @param rect     rect of src, or NULL for the whole src.
+ */
+void cons_blit(cons_surface_t* dst, cons_pos_t x, cons_pos_t y, cons_surface_t* src, cons_rect_t const* rect) {
+    cons_cbuf_t* d = dst ? &dst->buf : cons_screen();
+    cons_cbuf_t* s = &src->buf;
+    cons_cell_t  c;
+    unsigned     so, dof, put = 0;
+    int sx = 0, sy = 0, w = s->w, h = s->h, dx = x, dy = y, i, i0, i1, j;
+    if (!d || !d->cells || !s->cells || dst == src)
+        return;
+    if (rect) {
+        sx = rect->x;
+        sy = rect->y;
+        w  = rect->w;
+        h  = rect->h;
+    }
+    if (sx < 0) { dx -= sx; w += sx; sx = 0; }
+    if (sy < 0) { dy -= sy; h += sy; sy = 0; }
+    if (sx + w > s->w) w = s->w - sx;
+    if (sy + h > s->h) h = s->h - sy;
+    if (dx < 0) { sx -= dx; w += dx; dx = 0; }
+    if (dy < 0) { sy -= dy; h += dy; dy = 0; }
+    if (dx + w > d->w) w = d->w - dx;
+    if (dy + h > d->h) h = d->h - dy;
+    if (w <= 0 || h <= 0)
+        return;
+    surface_scan(src);
+    for (j = 0; j < h; ++j) {
+        so  = cons_cbufIndex(s, sx, sy + j);
+        dof = cons_cbufIndex(d, dx, dy + j);
+        if (src->solid[sy + j]) {   // No CONS_CELL_NONE. Copy the changed span as a block.
+            for (i0 = 0; i0 < w && cons_cbufCell(s, so + i0) == cons_cbufCell(d, dof + i0); ++i0)
+                ;
+            if (i0 == w)
+                continue;
+            for (i1 = w; cons_cbufCell(s, so + i1 - 1) == cons_cbufCell(d, dof + i1 - 1); --i1)
+                ;
+            cons_cbufBlit(d, dx + i0, dy + j, s, sx + i0, sy + j, i1 - i0, 1);
+        } else {
+            i0 = w;
+            i1 = 0;
+            for (i = 0; i < w; ++i) {
+                c = cons_cbufCell(s, so + i);
+                if (c != CONS_CELL_NONE && c != cons_cbufCell(d, dof + i)) {
+                    cons_cbufSetCell(d, dof + i, c);
+                    ++put;
+                    if (i0 > i)
+                        i0 = i;
+                    i1 = i + 1;
+                }
+            }
+            if (i0 < i1)
+                cons_cbufMarkDirty(d, dy + j, dx + i0, dx + i1);
+        }
+    }
+    _cons_PRIVATE_statsAdd(cells_put, put);
+}
@@ -0,0 +1,48 @@
+/**
+ *  @file cons_surface.h
+ *  @brief Off-screen cell buffers composited onto the screen.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Included from the backend header after cons_trace.h.
+ *   A surface is a cons_cbuf_t in the screen's cell format. Draw a layer that
+ *   rarely changes into it once, then cons_blit() it every time it is needed.
+ *   Cells that are CONS_CELL_NONE are transparent; cons_blit() leaves the
+ *   cells under them as they are.
+ *   Write the cells with cons_surfacePuts(), cons_surfacePutGlyph(), or the
+ *   cons_cbuf functions on s->buf. Those mark dirty spans; cons_blit() uses
+ *   them to know which rows of the source to scan for CONS_CELL_NONE again.
+ *   A row without CONS_CELL_NONE is copied as one block.
+ *   cons_blit() only writes cells that differ, so blitting an unchanged layer
+ *   every frame adds nothing to present.
+ */
+#ifndef CONS_SURFACE_H__
+#define CONS_SURFACE_H__
+
+#define CONS_CELL_NONE          ((cons_cell_t)~(cons_cell_t)0)  ///< Transparent cell. (PC-AT: character 0xFF in color 0xFF can not be drawn to a surface.)
+
+/** Rect of cells.
+ */
+typedef struct cons_rect_t {
+    cons_pos_t      x;
+    cons_pos_t      y;
+    cons_pos_t      w;
+    cons_pos_t      h;
+} cons_rect_t;
+
+/** Off-screen cell buffer.
+ */
+typedef struct cons_surface_t {
+    cons_cbuf_t     buf;        ///< Cells. The dirty spans are rows to scan again, not to present.
+    unsigned char*  solid;      ///< Row y has no CONS_CELL_NONE. Valid for the rows that are not dirty.
+} cons_surface_t;
+
+int  cons_surfaceInit(cons_surface_t* s, cons_pos_t w, cons_pos_t h);
+void cons_surfaceTerm(cons_surface_t* s);
+void cons_surfaceClear(cons_surface_t* s);
+void cons_surfacePuts(cons_surface_t* s, cons_pos_t x, cons_pos_t y, cons_col_t col, char const* str);
+void cons_surfacePutGlyph(cons_surface_t* s, cons_pos_t x, cons_pos_t y, cons_col_t col, cons_glyph_t id);
+void cons_blit(cons_surface_t* dst, cons_pos_t x, cons_pos_t y, cons_surface_t* src, cons_rect_t const* rect);
+
+#endif //CONS_SURFACE_H__
@@ -0,0 +1,372 @@
+/**
+ *  @file cons_text.c
+ *  @brief Text drawing to cells, shared by the terminal backends (curses, server).
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ */
+#include "cons.h"
+#include "cons_text.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#if !defined(_WIN32) && !defined(__DOS__)
+#include <sys/ioctl.h>
+#endif
+
+cons_text_t* _cons_PRIVATE_text;
+
+/** Reallocate the screen of t to w x h. Keep what fits.
+ *  @return 0:out of memory. The screen is released.
+ */
+int _cons_PRIVATE_textResize(cons_text_t* t, cons_pos_t w, cons_pos_t h) {
+    cons_cbuf_t old = t->screen;
+    if (!cons_cbufInit(&t->screen, w, h, NULL)) {
+        cons_cbufTerm(&old);
+        return 0;
+    }
+    cons_cbufFill(&t->screen, 0, 0, w, h, CELL(' ', 0));
+    if (old.cells)
+        cons_cbufBlit(&t->screen, 0, 0, &old, 0, 0, old.w, old.h);
+    cons_cbufTerm(&old);
+    cons_cbufMarkAll(&t->screen);
+    return 1;
+}
+
+/** Cell of code point cp. Its columns (0, 1 or 2) to *w.
+ *  Measured with the table in cons_uwidth.c, not with the locale.
+ */
+static cons_cell_t _cons_measure(unsigned long cp, unsigned* w) {
+ #if defined(CELL_UTF8)
+    unsigned k = (cp < 0x80) ? CONS_UW_NARROW : cons_uwidthClass(cp);
+    if (k == CONS_UW_AMBI) {
+        if (_cons_PRIVATE_text->ambiWide) {
+            *w = 2;
+            return CELL_AMBI | cp;
+        }
+        k = CONS_UW_NARROW;
+    }
+    *w = (k == CONS_UW_WIDE) ? 2 : (k == CONS_UW_ZERO) ? 0 : 1;
+ #else
+    *w = 1;
+ #endif
+    return (cons_cell_t)cp;
+}
+
+/** Decode one character of *ps.
+ */
+static unsigned long _cons_decode(unsigned char const** ps) {
+    unsigned char const* s = *ps;
+    unsigned long        c = *s++;
+ #if defined(CELL_UTF8)
+    unsigned             n, i;
+    if (c >= 0x80) {
+        if (c >= 0xC2 && c <= 0xDF)      { n = 1; c &= 0x1F; }
+        else if (c >= 0xE0 && c <= 0xEF) { n = 2; c &= 0x0F; }
+        else if (c >= 0xF0 && c <= 0xF4) { n = 3; c &= 0x07; }
+        else                             { *ps = s; return CELL_RAW | c; }
+        for (i = 0; i < n; ++i) {
+            if ((s[i] & 0xC0) != 0x80) {
+                *ps = s;
+                return CELL_RAW | (*(s - 1));
+            }
+            c = (c << 6) | (s[i] & 0x3F);
+        }
+        s += n;
+    }
+ #endif
+    *ps = s;
+    return c;
+}
+
+/** Decode str to cells. A wide character is the cell and CELL_WIDE_R.
+ *  Zero width characters are dropped.
+ *  @return number of cells written to d[0 .. max). Stops before the cell pair which does not fit.
+ */
+static unsigned _cons_decodeCells(cons_cell_t* d, unsigned char const** ps, unsigned max) {
+    unsigned char const* s = *ps;
+    unsigned             n = 0, w;
+    cons_cell_t          c;
+    while (*s && n + 2 <= max) {
+        c = _cons_measure(_cons_decode(&s), &w);
+        if (w == 0)
+            continue;
+        d[n++] = c;
+        if (w == 2)
+            d[n++] = CELL_WIDE_R;
+    }
+    *ps = s;
+    return n;
+}
+
+/** Encode code point cp to d[]. Bytes kept by _cons_decode are written as is.
+ *  @return number of bytes.
+ */
+unsigned _cons_PRIVATE_utf8(char* d, unsigned long cp) {
+ #if defined(CELL_UTF8)
+    if (cp < 0x80 || (cp & ~0xFFUL) == CELL_RAW) {
+        d[0] = (char)cp;
+        return 1;
+    } else if (cp < 0x800) {
+        d[0] = (char)(0xC0 | (cp >> 6));
+        d[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+    } else if (cp < 0x10000) {
+        d[0] = (char)(0xE0 | (cp >> 12));
+        d[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        d[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+    }
+    d[0] = (char)(0xF0 | (cp >> 18));
+    d[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    d[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    d[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
+ #else
+    d[0] = (char)cp;
+    return 1;
+ #endif
+}
+
+/** Before writing from x of row y: break a wide character cut at its right half.
+ */
+static void _cons_fixLeft(cons_cbuf_t* b, cons_pos_t x, cons_pos_t y) {
+    cons_cell_t CONS_CELL_FAR* row = cons_cbufAt(b, 0, y);
+    if (x > 0 && x < b->w && CELL_CP(row[x]) == CELL_WIDE_R) {
+        row[x - 1] = CELL(' ', CELL_COL(row[x - 1]));
+        cons_cbufMarkDirty(b, y, x - 1, x);
+    }
+}
+
+/** After writing [x0, x1) of row y: mark it dirty and remove a right half left alone at x1.
+ */
+static void _cons_fixRight(cons_cbuf_t* b, cons_pos_t x0, cons_pos_t x1, cons_pos_t y) {
+    cons_cell_t CONS_CELL_FAR* row = cons_cbufAt(b, 0, y);
+    if (x1 < b->w && CELL_CP(row[x1]) == CELL_WIDE_R) {
+        row[x1] = CELL(' ', CELL_COL(row[x1]));
+        ++x1;
+    }
+    cons_cbufMarkDirty(b, y, x0, x1);
+}
+
+/** Put cells src[0 .. n) at the cursor with color col. Wraps at the right edge like addstr().
+ */
+static void _cons_putCells(cons_cell_t const* src, unsigned n, cons_col_t col) {
+    cons_text_t*    t  = _cons_PRIVATE_text;
+    cons_cbuf_t*    b  = &t->screen;
+    cons_cell_t CONS_CELL_FAR* row;
+    cons_cell_t     c;
+    cons_cell_t     cc = CELL(0, col);
+    unsigned        i, put = 0;
+    int             w;
+    cons_pos_t      x0 = t->cur_x;
+    if (!b->cells || t->cur_y < 0 || t->cur_y >= b->h || t->cur_x < 0 || t->cur_x >= b->w)
+        return;
+    row = cons_cbufAt(b, 0, t->cur_y);
+    _cons_fixLeft(b, t->cur_x, t->cur_y);
+    for (i = 0; i < n; ++i) {
+        c = src[i];
+        if (CELL_CP(c) == CELL_WIDE_R)
+            continue;
+        w = (i + 1 < n && CELL_CP(src[i + 1]) == CELL_WIDE_R) ? 2 : 1;
+        if (CELL_CP(c) == '\n' || t->cur_x + w > b->w) {
+            _cons_fixRight(b, x0, t->cur_x, t->cur_y);
+            t->cur_x = x0 = 0;
+            if (++t->cur_y >= b->h)
+                t->cur_y = 0;
+            row = cons_cbufAt(b, 0, t->cur_y);
+            _cons_fixLeft(b, 0, t->cur_y);
+            if (CELL_CP(c) == '\n')
+                continue;
+        }
+        row[t->cur_x++] = c | cc;
+        if (w == 2)
+            row[t->cur_x++] = CELL_WIDE_R | cc;
+        put += w;
+    }
+    _cons_fixRight(b, x0, t->cur_x, t->cur_y);
+    _cons_PRIVATE_statsAdd(cells_put, put);
+}
+
+void cons_clear(void) {
+    cons_text_t* t = _cons_PRIVATE_text;
+    cons_cbufFill(&t->screen, 0, 0, t->screen.w, t->screen.h, CELL(' ', 0));
+    t->cur_x = t->cur_y = 0;
+}
+
+/** Make a cell of ch and color col.
+ *  @param ch   unicode code point (a character code on DOS).
+ */
+cons_cell_t cons_makeCell(unsigned ch, cons_col_t col) {
+    return CELL(ch, col);
+}
+
+/** The screen buffer. Reallocated when the terminal is resized.
+ */
+cons_cbuf_t* cons_screen(void) {
+    return &_cons_PRIVATE_text->screen;
+}
+
+void cons_setxy(cons_pos_t x, cons_pos_t y) {
+    _cons_PRIVATE_text->cur_x = x;
+    _cons_PRIVATE_text->cur_y = y;
+}
+
+void cons_setcolor(cons_col_t col) {
+    _cons_PRIVATE_text->cur_col = col;
+}
+
+void cons_resetcolor(cons_col_t col) {
+    (void)col;
+    _cons_PRIVATE_text->cur_col = CONS_COL_DEFAULT;
+}
+
+/** Put string.
+ */
+void cons_puts(char const* str) {
+    cons_cell_t          buf[64];
+    unsigned char const* s = (unsigned char const*)str;
+    while (*s)
+        _cons_putCells(buf, _cons_decodeCells(buf, &s, 64), _cons_PRIVATE_text->cur_col);
+}
+
+/** Decode and measure a string once.
+ *  Call after cons_init(). The result depends on CONS_INIT_AMBI_WIDE.
+ *  @return [0]:number of cells, [1..]:cells. Release with cons_encodeFree().
+ */
+cons_enc_t cons_encode(char const* str) {
+    unsigned char const* s = (unsigned char const*)str;
+    size_t               l = strlen(str);
+    cons_cell_t*         e = (cons_cell_t*)malloc((l + 3) * sizeof(cons_cell_t));
+    if (!e)
+        return NULL;
+    e[0] = _cons_decodeCells(e + 1, &s, (unsigned)l + 2);
+    return e;
+}
+
+/** Decode and measure str to cells without color. Used by cons_glyphRegister().
+ *  @return number of cells. 0 when str is "" or does not fit in max cells.
+ */
+unsigned cons_encodeCells(cons_cell_t* d, char const* str, unsigned max) {
+    unsigned char const* s = (unsigned char const*)str;
+    unsigned             n = _cons_decodeCells(d, &s, max);
+    return *s ? 0 : n;
+}
+
+/** Release a string made by cons_encode().
+ */
+void cons_encodeFree(cons_enc_t e) {
+    free((void*)e);
+}
+
+/** Set position(x,y) and put a string made by cons_encode().
+ */
+void cons_xycputEncoded(cons_pos_t x, cons_pos_t y, cons_col_t col, cons_enc_t e) {
+    if (!e)
+        return;
+    cons_setxy(x, y);
+    cons_setcolor(col);
+    _cons_putCells(e + 1, (unsigned)e[0], col);
+}
+
+void cons_xyputs(cons_pos_t x, cons_pos_t y, char const* s) {
+    cons_setxy(x, y);
+    cons_puts(s);
+}
+
+void cons_xycputs(cons_pos_t x, cons_pos_t y, cons_col_t c, char const* s) {
+    _cons_PRIVATE_statsAdd(puts_calls, 1);
+    cons_setxy(x, y);
+    cons_setcolor(c);
+    cons_puts(s);
+}
+
+void cons_printf(char const* fmt, ...) {
+    char buf[CONS_PRINTF_BUF_SIZE];
+    va_list arg;
+    va_start(arg, fmt);
+    vsnprintf(buf, CONS_PRINTF_BUF_SIZE-1, fmt, arg);
+    buf[CONS_PRINTF_BUF_SIZE-1] = 0;
+    cons_puts(buf);
+    va_end(arg);
+}
+
+void cons_xyprintf(cons_pos_t x, cons_pos_t y, char const* fmt, ...) {
+    char buf[CONS_PRINTF_BUF_SIZE];
+    va_list arg;
+    va_start(arg, fmt);
+    vsnprintf(buf, CONS_PRINTF_BUF_SIZE-1, fmt, arg);
+    buf[CONS_PRINTF_BUF_SIZE-1] = 0;
+    cons_xyputs(x, y, buf);
+    va_end(arg);
+}
+
+void cons_xycprintf(cons_pos_t x, cons_pos_t y, cons_col_t c, char const* fmt, ...) {
+    char buf[CONS_PRINTF_BUF_SIZE];
+    va_list arg;
+    va_start(arg, fmt);
+    vsnprintf(buf, CONS_PRINTF_BUF_SIZE-1, fmt, arg);
+    buf[CONS_PRINTF_BUF_SIZE-1] = 0;
+    cons_xycputs(x, y, c, buf);
+    va_end(arg);
+}
+
+/** Bytes in the output queue of fd. -1:unknown.
+ */
+static long _cons_outQueue(int fd) {
+ #if defined(TIOCOUTQ)
+    int n = 0;
+    if (fd >= 0 && ioctl(fd, TIOCOUTQ, &n) == 0)
+        return n;
+ #else
+    (void)fd;
+ #endif
+    return -1;
+}
+
+/** May a frame be presented to fd now?
+ *  @return 0:the terminal is behind. Keep the dirty spans for a later frame.
+ */
+int _cons_PRIVATE_paceReady(cons_pace_t* p, int fd) {
+    unsigned long now = _cons_PRIVATE_statsUsec();
+    unsigned long dt  = now - p->t_queued;
+    unsigned long limit, rate;
+    long          q;
+    if (p->busy_until) {
+        if ((long)(now - p->busy_until) < 0) {
+            _cons_PRIVATE_statsAdd(deferred, 1);
+            return 0;
+        }
+        p->busy_until = 0;
+    }
+    q = _cons_outQueue(fd);
+    if (q < 0)
+        return 1;
+    if (p->queued > q && dt >= 1000) {     // Drained since the last look.
+        rate    = (unsigned long)(p->queued - q) * 1000UL / (dt / 1000);
+        p->rate = p->rate ? (p->rate * 3 + rate) / 4 : rate;
+    }
+    p->queued   = q;
+    p->t_queued = now;
+    limit = p->rate / (1000000UL / CONS_PACE_FRAME_USEC);
+    if (limit < CONS_PACE_QUEUE_MIN)
+        limit = CONS_PACE_QUEUE_MIN;
+    if ((unsigned long)q <= limit)
+        return 1;
+    _cons_PRIVATE_statsAdd(deferred, 1);
+    return 0;
+}
+
+/** A frame was written to fd. t_write is the time the write began.
+ */
+void _cons_PRIVATE_paceSent(cons_pace_t* p, int fd, unsigned long t_write) {
+    unsigned long now = _cons_PRIVATE_statsUsec();
+    long          q   = _cons_outQueue(fd);
+    if (q >= 0) {
+        p->queued   = q;
+        p->t_queued = now;
+    }
+    if (now - t_write > CONS_PACE_BLOCK_USEC)
+        p->busy_until = (now + (now - t_write)) | 1;   // Not 0.
+}
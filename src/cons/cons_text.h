@@ -0,0 +1,66 @@
+/**
+ *  @file cons_text.h
+ *  @brief Text drawing to cells, shared by the terminal backends (curses, server).
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Private header of the backends. Not included from cons.h.
+ *   A cell is (color << 24) | code point. Strings are UTF-8 (bytes on DOS).
+ *   A wide character takes its cell and a CELL_WIDE_R cell.
+ */
+#ifndef CONS_TEXT_H__
+#define CONS_TEXT_H__
+
+#if !defined(__DOS__)
+#define CELL_UTF8                   // Strings are UTF-8. Cells hold code points.
+#include "cons_uwidth.h"
+#endif
+
+#define CELL(cp,col)        (((cons_cell_t)(col) << 24) | (cp))
+#define CELL_CP(c)          ((unsigned long)((c) & 0x1fffff))
+#define CELL_COL(c)         ((cons_col_t)((c) >> 24))
+#define CELL_AMBI           (1UL << 23) ///< Ambiguous width character drawn as wide.
+#define CELL_WIDE_R         0           ///< Code of the right half of a wide character.
+#define CELL_RAW            0xDC00      ///< CELL_RAW | byte : a byte that is not UTF-8.
+#define CELL_INVALID        (~(cons_cell_t)0)
+
+/** Screen and drawing state of one terminal.
+ *  curses has one. The server has one per session.
+ */
+typedef struct cons_text_t {
+    cons_cbuf_t     screen;
+    cons_pos_t      cur_x;
+    cons_pos_t      cur_y;
+    cons_col_t      cur_col;
+    unsigned char   ambiWide;       ///< CONS_INIT_AMBI_WIDE
+} cons_text_t;
+
+extern cons_text_t* _cons_PRIVATE_text;     ///< Drawing goes here. Set by the backend.
+
+int      _cons_PRIVATE_textResize(cons_text_t* t, cons_pos_t w, cons_pos_t h);
+unsigned _cons_PRIVATE_utf8(char* d, unsigned long cp);
+
+#define CONS_PACE_FRAME_USEC    50000UL     ///< A frame. The queue may hold what drains in it.
+#define CONS_PACE_QUEUE_MIN     512         ///< Bytes always allowed in the output queue.
+#define CONS_PACE_BLOCK_USEC    20000UL     ///< A write blocked longer than this means the link is slow.
+
+/** Output pacing of one terminal.
+ *  A frame is presented only when the terminal has taken most of the earlier
+ *  ones. Else the dirty spans are kept, and merged into a later frame, so the
+ *  newest screen is sent instead of a queue of old ones.
+ *  A write that blocked makes the next frames wait as long as it blocked.
+ *  Where the driver tells the queue size by TIOCOUTQ (serial lines, and
+ *  sockets as SIOCOUTQ; not ptys), the queue may only hold what drains in a frame.
+ */
+typedef struct cons_pace_t {
+    unsigned long   rate;           ///< Estimated drain rate. Bytes per second. 0:unknown.
+    unsigned long   t_queued;       ///< Time of queued.
+    unsigned long   busy_until;     ///< Without TIOCOUTQ: no frame until then.
+    long            queued;         ///< Bytes in the output queue. -1:unknown.
+} cons_pace_t;
+
+int  _cons_PRIVATE_paceReady(cons_pace_t* p, int fd);
+void _cons_PRIVATE_paceSent(cons_pace_t* p, int fd, unsigned long t_write);
+
+#endif //CONS_TEXT_H__
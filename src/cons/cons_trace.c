@@ -0,0 +1,119 @@
+/**
+ *  @file cons_trace.c
+ *  @brief Frame timeline recorder. Written as a trace event JSON file.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   File format: {"traceEvents":[ {"name":..,"ph":"B"|"E","ts":usec,"pid":1,"tid":1}, ... ]}
+ *   Times are from the first event kept, by _cons_PRIVATE_statsUsec().
+ *   Names are written as is. Use identifiers or plain words.
+ */
+#include "cons.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef struct trace_event_t {
+    char const*     name;       ///< Not copied. A string literal.
+    unsigned long   us;
+    char            ph;         ///< 'B':begin 'E':end.
+} trace_event_t;
+
+static trace_event_t*   s_trace_ring;
+static unsigned         s_trace_size;
+static unsigned         s_trace_pos;        ///< Next slot.
+static unsigned         s_trace_wrapped;    ///< The ring was filled once.
+static char const*      s_trace_path;
+static int              s_trace_atexit;
+
+/** Start recording. path is written at cons_traceClose() or at exit.
+ *  @param events   size of the ring. 0:CONS_TRACE_EVENTS.
+ *  @return 0:out of memory.
+ */
+int cons_traceOpen(char const* path, unsigned events) {
+    cons_traceClose();
+    if (events == 0)
+        events = CONS_TRACE_EVENTS;
+    if (events > (unsigned)-1 / sizeof(trace_event_t))
+        return 0;
+    s_trace_ring = (trace_event_t*)malloc(events * sizeof(trace_event_t));
+    if (!s_trace_ring)
+        return 0;
+    s_trace_size    = events;
+    s_trace_pos     = 0;
+    s_trace_wrapped = 0;
+    s_trace_path    = path;
+    if (!s_trace_atexit) {
+        s_trace_atexit = 1;
+        atexit(cons_traceClose);
+    }
+    return 1;
+}
+
+/** Record one event. Does nothing until cons_traceOpen().
+ */
+void _cons_PRIVATE_traceEvent(char const* name, char ph, unsigned long us) {
+    trace_event_t* e;
+    if (!s_trace_ring)
+        return;
+    e       = &s_trace_ring[s_trace_pos];
+    e->name = name;
+    e->us   = us;
+    e->ph   = ph;
+    if (++s_trace_pos >= s_trace_size) {
+        s_trace_pos     = 0;
+        s_trace_wrapped = 1;
+    }
+}
+
+/** Begin of a phase named name.
+ */
+void cons_traceBegin(char const* name) {
+    if (s_trace_ring)
+        _cons_PRIVATE_traceEvent(name, 'B', _cons_PRIVATE_statsUsec());
+}
+
+/** End of a phase named name.
+ */
+void cons_traceEnd(char const* name) {
+    if (s_trace_ring)
+        _cons_PRIVATE_traceEvent(name, 'E', _cons_PRIVATE_statsUsec());
+}
+
+/** Write the events kept in the ring to the file, and stop recording.
+ *  Ends whose begin was overwritten are dropped.
+ */
+void cons_traceClose(void) {
+    trace_event_t const* e;
+    FILE*                fp;
+    unsigned             i, n, depth = 0, first = 1;
+    unsigned long        t0;
+    if (!s_trace_ring)
+        return;
+    fp = fopen(s_trace_path, "wt");
+    if (fp) {
+        i  = s_trace_wrapped ? s_trace_pos : 0;
+        n  = s_trace_wrapped ? s_trace_size : s_trace_pos;
+        t0 = s_trace_ring[i].us;
+        fputs("{\"traceEvents\":[\n", fp);
+        for (; n > 0; --n) {
+            e = &s_trace_ring[i];
+            if (++i >= s_trace_size)
+                i = 0;
+            if (e->ph == 'E') {
+                if (depth == 0)
+                    continue;
+                --depth;
+            } else {
+                ++depth;
+            }
+            fprintf(fp, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lu,\"pid\":1,\"tid\":1}",
+                    first ? "" : ",\n", e->name, e->ph, e->us - t0);
+            first = 0;
+        }
+        fputs("\n]}\n", fp);
+        fclose(fp);
+    }
+    free(s_trace_ring);
+    s_trace_ring = NULL;
+}
@@ -0,0 +1,37 @@
+/**
+ *  @file cons_trace.h
+ *  @brief Frame timeline recorder. Written as a trace event JSON file.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Included from the backend header after cons_stats.h.
+ *   Off until cons_traceOpen(). The ring of events is allocated there, and
+ *   the file is written by cons_traceClose() or at exit. Recording an event
+ *   only stores the name pointer and the time; when the ring is full the
+ *   oldest events are overwritten.
+ *   Every frame is recorded as "frame", "cons_updateBegin" and "cons_updateEnd".
+ *   Games add their own phases with cons_traceBegin()/cons_traceEnd().
+ *   The file opens in chrome://tracing or Perfetto.
+ */
+#ifndef CONS_TRACE_H__
+#define CONS_TRACE_H__
+
+#ifndef CONS_TRACE_EVENTS
+#if defined(__I86__) || defined(__ia16__)
+#define CONS_TRACE_EVENTS       1024    ///< Default size of the ring.
+#else
+#define CONS_TRACE_EVENTS       65536   ///< Default size of the ring.
+#endif
+#endif
+
+int  cons_traceOpen(char const* path, unsigned events);
+void cons_traceClose(void);
+void cons_traceBegin(char const* name);
+void cons_traceEnd(char const* name);
+
+#if 1 // private name.
+    void _cons_PRIVATE_traceEvent(char const* name, char ph, unsigned long us);
+#endif
+
+#endif //CONS_TRACE_H__
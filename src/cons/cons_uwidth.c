@@ -0,0 +1,528 @@
+/**
+ *  @file cons_uwidth.c
+ *  @brief East Asian Width of unicode code points.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Generated by src/tool/uwidth/gen_uwidth.py (Unicode 14.0.0). Do not edit.
+ */
+#include "cons_uwidth.h"
+
+/** (code point >> 7) -> block.
+ */
+static unsigned char const s_uwPage[0x400] = {
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+     32, 33, 34, 35, 36, 37, 38, 39,  0,  0,  0,  0,  0, 40, 41, 42,
+     43, 44, 45, 46, 47, 48, 49, 50, 51, 52,  0, 53,  0,  0, 54, 55,
+     56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+      0,  0,  0,  0,  0,  0, 72, 73,  0, 74, 75, 76, 77, 78, 78, 78,
+     79, 80, 78, 78, 81, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 82, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 83,  0,  0, 84, 85,  0, 86,
+     87, 88, 89, 90, 91, 92, 93, 94, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 95,
+      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+     96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+     96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+     96, 96, 78, 78, 78, 78, 97, 98,  0,  0,  0, 99,100,101,102,103,
+    104,105,106,107, 78,108,109,110,  0,111,112,113,  0,  0,114,115,
+    116,117,118,119,120,121,122,123,124,125,126, 78,127,128,129,130,
+    131,132,133,134,135,136,137, 78,138,139, 78,140,141,142,143, 78,
+    144,145,146,147,148,149, 78, 78,150,151,152,153, 78,154, 78,155,
+      0,  0,  0,  0,  0,  0,  0,156,157,  0,158, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,159,
+      0,  0,  0,  0,  0,  0,  0,  0,160, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78,  0,  0,  0,  0,161, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+      0,  0,  0,  0,162,163,164,165, 78, 78, 78, 78, 82,166,167,168,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78,169,170, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+     78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,171,158,
+      0,172,173,174,175,176,177, 78,178,179,180,  0,  0,181,  0,182,
+      0,  0,  0,  0,183,184, 78, 78, 78, 78, 78, 78, 78, 78,185, 78,
+    186, 78,187, 78, 78,188, 78, 78, 78, 78, 78, 78, 78, 78, 78,189,
+      0,190,191, 78, 78, 78, 78, 78,192,193,194, 78,195,196, 78, 78,
+    197,198,199,200, 78, 78,201,202,203,204,205,206, 83,207,208,209,
+    210,211,212, 78,213, 78,  0,214, 78, 78, 78, 78, 78, 78, 78, 78,
+};
+
+/** 2 bits per code point. CONS_UW_NARROW, CONS_UW_WIDE, CONS_UW_AMBI or CONS_UW_ZERO.
+ */
+static unsigned char const s_uwBlock[215][32] = {
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x82,0x22,0x28,0xaa,0xa2,0x2a,0xaa,
+      0x00,0x20,0x00,0x00,0x02,0x80,0x02,0xa0,0x0a,0x20,0x2a,0x0a,0xa2,0x80,0x2a,0x22 },
+    { 0x08,0x00,0x00,0x00,0x88,0x00,0x80,0x00,0x00,0xa0,0x80,0x00,0xa8,0x00,0x02,0x80,
+      0x2a,0x02,0xaa,0x08,0xa0,0x00,0x00,0x00,0x00,0xa0,0x80,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x20,0x22,0x22,0x22,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x82,0xa8,0x08,0x02,0x00,0xaa,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x05,0x00 },
+    { 0x55,0x00,0x40,0x04,0xa8,0xaa,0xaa,0xaa,0x9a,0xaa,0x0a,0x00,0xa8,0xaa,0xaa,0xaa,
+      0x8a,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x08,0x00,0x00,0x00,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+      0xaa,0xaa,0xaa,0xaa,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0xc0,0xff,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x40,0x01,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xcf,
+      0x3c,0xcf,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x15,0x00,0x54,0x55,0x55 },
+    { 0xff,0x0f,0x00,0x00,0xff,0xff,0x3f,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0xc0,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0xf0,0xff,0xcf,0xff,0xc3,0xf3,0x0f,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0xd0,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,
+      0xff,0xff,0x7f,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xff,0xff,0x53,0x55,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xff,0x00,0x40,0x0d },
+    { 0x00,0x00,0x00,0x00,0x00,0xf0,0xcf,0xff,0xff,0xfc,0xfc,0x5f,0x00,0x00,0x00,0x40,
+      0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x45,0x00,0x00,0x40,0x55,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x40,0x5f,0x55,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0xf0,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff },
+    { 0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x03,
+      0xfc,0xff,0x03,0x0c,0xfc,0xff,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x0c,0x01,0x00,0x14,0x14,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x44,0x05,0x50,0x03,
+      0xfc,0x17,0x14,0x4c,0x55,0x15,0x55,0x10,0xf0,0x05,0x00,0x00,0x00,0x00,0x00,0x70 },
+    { 0x3d,0x01,0x40,0x15,0x14,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x41,0x50,0x07,
+      0x7c,0xd5,0xd7,0x5f,0x5d,0x55,0x01,0x44,0x55,0x05,0x00,0x00,0x0f,0x4c,0x55,0x55 },
+    { 0x3d,0x01,0x00,0x10,0x10,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x01,0x50,0x03,
+      0xfc,0xdf,0x13,0x5c,0x54,0x55,0x55,0x55,0xf0,0x05,0x00,0x00,0x50,0x55,0xf1,0xff },
+    { 0x0d,0x01,0x00,0x14,0x14,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x01,0x50,0xc3,
+      0xfc,0x17,0x14,0x5c,0x55,0x3d,0x55,0x10,0xf0,0x05,0x00,0x00,0x00,0x00,0x55,0x55 },
+    { 0x35,0x01,0x40,0x05,0x04,0x50,0x41,0x04,0x15,0x54,0x40,0x05,0x00,0x00,0x50,0x05,
+      0x43,0x05,0x04,0x5c,0x54,0x15,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x40,0x55 },
+    { 0x03,0x03,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x50,0xf3,
+      0x03,0xf4,0xf7,0x5f,0x55,0x7d,0x40,0x51,0xf0,0x05,0x00,0x00,0x55,0x15,0x00,0x00 },
+    { 0x0c,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x01,0x50,0xc3,
+      0x00,0x34,0x04,0x5f,0x55,0x41,0x55,0x41,0xf0,0x05,0x00,0x00,0x41,0x55,0x55,0x55 },
+    { 0x0f,0x00,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x03,
+      0xfc,0x07,0x04,0x0c,0x55,0x00,0x00,0x00,0xf0,0x05,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x0d,0x01,0x00,0x00,0x00,0x40,0x05,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x51,
+      0x00,0x40,0x75,0x15,0xf0,0x77,0x00,0x00,0x55,0x05,0x00,0x00,0x05,0x54,0x55,0x55 },
+    { 0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xff,0x7f,0x15,
+      0x00,0xc0,0xff,0x3f,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x41,0x04,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x00,0x00,0x0c,0xff,0xff,0x53,
+      0x00,0x44,0xff,0x5f,0x00,0x00,0x50,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0xcc,0x0c,0x00,
+      0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xfd,0xff,0xff,0x3f },
+    { 0xff,0xf3,0x00,0xfc,0xff,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x07,
+      0x00,0x30,0x00,0x04,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xf3,0xff,0x3c,0x3c,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,0x03,0x00,0x00,0x00,0xfc,0x03,0x00,0x00 },
+    { 0x30,0x3c,0x00,0x0c,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x10,0x55,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff },
+    { 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x04,0x50,0x00,0x40,0x04,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x04,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x50,0x00,0x40,
+      0x04,0x50,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x04,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xfd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x50 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55 },
+    { 0x00,0x00,0x00,0x00,0xf0,0x53,0x55,0x15,0x00,0x00,0x00,0x00,0xf0,0x40,0x55,0x55,
+      0x00,0x00,0x00,0x00,0xf0,0x55,0x55,0x55,0x00,0x00,0x00,0x04,0xf4,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xcf,0xff,0x0f,
+      0x00,0x30,0xfc,0xff,0xff,0x00,0x00,0x5c,0x00,0x00,0x50,0x55,0x00,0x00,0x50,0x55 },
+    { 0x00,0x00,0xc0,0xff,0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55 },
+    { 0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x3f,0xc0,0x03,0x55,0x30,0x00,0xfc,0x55,
+      0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x54,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x50,0x55,0x00,0x00,0x40,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0xc0,0xc3,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x30,0xff,0x7f,0x33,0xfc,0xff,0x03,0xc0,0xff,0xff,0xd7 },
+    { 0x00,0x00,0x50,0x55,0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x50,0xff,0xff,0xff,0xff,
+      0xff,0xff,0xff,0x7f,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0x3f,0x03,
+      0x30,0x00,0x00,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xff,0x00,0x00,0x40 },
+    { 0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x0f,0xcf,0x0f,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x0f,0xcc,0x0f,0x55,0x55,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xf0,0x15,0x00,
+      0x00,0x00,0x50,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x54,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,
+      0x00,0x00,0x55,0x55,0x3f,0xff,0xff,0xff,0xf3,0xff,0x03,0x0c,0x00,0x03,0x4f,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff },
+    { 0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x50,0x00,0x50,0x00,0x00,0x11,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,
+      0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x01,0x00,0x00,0x00,0x00,0x05,0x04,0x00,0x40 },
+    { 0x00,0x00,0xc0,0xff,0x82,0x2a,0x0a,0x0a,0x2a,0xaa,0xf0,0x3f,0xa2,0x08,0x80,0x20,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf7,0xff,0xff,0x50,0x02,0x00,0x80 },
+    { 0xa8,0x02,0x00,0x40,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+      0x54,0x55,0x55,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x57,0x55,0x55,0x55 },
+    { 0x80,0x08,0x08,0x00,0x80,0x20,0x00,0x00,0x28,0x20,0x80,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x80,0x02,0x80,0x2a,0xaa,0xaa,0xaa,0x00,0xaa,0xaa,0x0a,0x00 },
+    { 0x00,0x00,0x08,0x55,0xaa,0xaa,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,
+      0x00,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0xa2,0x80,0x82,0x80,0x08,0x08,0x20,0xa8,0x82,0x88,0xaa,0x22,0x00,0xaa,0x00,0x0a,
+      0x00,0x00,0x02,0x02,0x20,0x00,0x00,0x00,0x0a,0xaa,0xa0,0xa0,0x00,0x00,0x00,0x00 },
+    { 0xa0,0xa0,0x00,0x00,0x00,0x08,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x80,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x20,0x00,0x50,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x01,0x41,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },
+    { 0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+      0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x8a,0xaa,0xaa,0xaa,0xaa,0xaa },
+    { 0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+      0xaa,0xaa,0xaa,0x00,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x00,0x00,0x00 },
+    { 0xaa,0xaa,0xaa,0xaa,0xa0,0x0a,0x00,0x00,0x8a,0xaa,0x0a,0x00,0xa0,0xa0,0x00,0x0a,
+      0x0a,0xa0,0x82,0xa0,0x0a,0x00,0x00,0x00,0xa0,0x0a,0x00,0x80,0x00,0x00,0x00,0x14 },
+    { 0x00,0x28,0x08,0xa0,0x00,0x05,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x22,0x00,0x55,0x55,0x55,0x00,0x00,0x00,0x8a,0x8a,0x2a,0x8a,0x00,0x00,0x00,0x40 },
+    { 0x00,0x00,0x00,0x00,0x40,0x00,0x00,0xa0,0x04,0x00,0x50,0x00,0x00,0x00,0x00,0x94,
+      0x00,0xa5,0xaa,0x9a,0xaa,0xa9,0xaa,0xaa,0x8a,0x00,0x9a,0xaa,0x5a,0xa6,0x9a,0xa6 },
+    { 0x00,0x04,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x08,
+      0x00,0x00,0x00,0x11,0x40,0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,0xaa,0xaa },
+    { 0x00,0x00,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x40,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x01,0xa4,0x0a,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0f,0x55,0x01,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x55,0x51,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x15,0x54,0x55,0x55,0xd5 },
+    { 0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,
+      0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0xf5,0x5f,0x55,0x55,0x55,0x15,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x7d,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0xaa,0xaa,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x3f,0xff,0xff,0x0f },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x40,0x55,0x10,0x01,0x50,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00 },
+    { 0x30,0x30,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x57,0x00,0x00,0x50,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x5f,0x55,0x05,0x00,0x00,0x50,0x55,0xff,0xff,0xff,0xff,0x0f,0x00,0x00,0xc0 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xff,0x0f,0x00,0x00,0x00,0x00,
+      0x00,0xc0,0xff,0xff,0x0f,0x55,0x55,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xf0,0x0f,0x0f,
+      0x00,0x00,0x00,0x10,0x00,0x00,0x50,0x05,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x40 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x3f,0x3c,0x7c,0x55,0x55,
+      0xc0,0x00,0x00,0x53,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xc3,0x03,0xf0,
+      0x4c,0x55,0x55,0x55,0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x0f,0x00,0x70,0x55,0x55 },
+    { 0x01,0x40,0x01,0x40,0x01,0x40,0x55,0x55,0x00,0x40,0x00,0x40,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x03,0x5c,0x00,0x00,0x50,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x40,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55 },
+    { 0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,
+      0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa },
+    { 0x00,0x40,0x55,0x55,0x15,0x00,0x55,0x31,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x44,
+      0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x40,0x55,0x55,0x55,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x55,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00 },
+    { 0xff,0xff,0xff,0xff,0x55,0x55,0x55,0x55,0xff,0xff,0xff,0xff,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x04,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd4 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+      0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x54,0x55,0x55,0x00,0x40,0x55,0x55,0xfd,0x58 },
+    { 0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x40,0x10,
+      0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55 },
+    { 0x40,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x54,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5c },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x54,0x55,0x55,0x55,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x01,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x40,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x7f,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x55,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x15,0x00,0x00,0x40,0x00 },
+    { 0x00,0x00,0x40,0x00,0x40,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x10,0x00,0x10,0x54,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x40,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x50,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x54,0x14,
+      0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x15,0x00,0x00,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x40,0x50,0x15,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x15,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x00,
+      0x00,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0xfc,0x7d,0x55,0xff,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x7f,0xd5,
+      0x00,0x00,0x54,0x55,0x00,0x00,0x54,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x15,0x00,0x00,0x40,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x01,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x50,0x55,0x01,0x54,0x55,0x55,0x01,0x00,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x05,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x55,0x55,0x00,0x00,0x50,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd0,0x53,0x50,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,
+      0x00,0xf0,0xff,0xff,0x03,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00 },
+    { 0xf0,0x0f,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55 },
+    { 0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+      0xff,0x3f,0x00,0x50,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc3,0x53,0x55,0xd5 },
+    { 0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x3f,0x3c,0x0c,
+      0x70,0x55,0x55,0x5d,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,0x00,0x00,0x50,0x55 },
+    { 0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xfc,0xff,0x07,0x00,0x00,
+      0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x40,0x55,0x55 },
+    { 0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xff,0x3f,
+      0x00,0x00,0xfc,0xc3,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x54,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0f,0xf3,0x00,0x70,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x40,0x04,0x10,0x00,0x00,0x00,0x10,0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xff,0x7f,0x55,0x00,0x00,0x50,0x55 },
+    { 0x0f,0x01,0x00,0x14,0x14,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x01,0xd0,0x03,
+      0x03,0x14,0x14,0x50,0x54,0x15,0x55,0x01,0x00,0xf5,0xff,0x57,0xff,0x57,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+      0xf0,0x33,0x00,0x00,0x00,0x00,0x00,0x31,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0x33,0xc0,
+      0xf3,0x00,0x55,0x55,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x5f,0x00,0xcf,
+      0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x5f,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0x3f,0xcc,
+      0x03,0x54,0x55,0x55,0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x54,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0c,0xff,0xcf,0x50,0x55,
+      0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xfd,0xf0,0xcf,0xff,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xff,0x3c,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x15 },
+    { 0x00,0x40,0x51,0x00,0x00,0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xd4,0x33,
+      0xc0,0x40,0x55,0x55,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0xff,0xf5,0x00,0x03,0x54,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0xfc,0xff,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xff,0xc3,0x3f,
+      0x00,0xc0,0x55,0x55,0xfc,0x3f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0xf0,0xff,0xff,0x3f,0x0f,0x00,0x40,0x55,0x55,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55 },
+    { 0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x7f,0xff,0xcf,
+      0x00,0x50,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0xf5,0xff,0xff,0xff,0xff,0xff,0xf1,0xff,0xf3,0x7c,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x40,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x7f,0x75,0xdf,
+      0xff,0xcf,0x55,0x55,0x00,0x00,0x50,0x55,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x40,0x1f,0xcc,0x54,0x55,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0xc0,0x03,0x54,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x54,0x55,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x15 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x54,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xff,0xff,0x57,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x50,0x05,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+      0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0xff,0x53,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x3f,0x00,0x00,
+      0x00,0x50,0x55,0x55,0x00,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x55,0x01 },
+    { 0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x40,0xd5,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x55,0xd5,0x3f,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x57,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x00,0x00,0x00,0x54 },
+    { 0x00,0x00,0x54,0x55,0x00,0x00,0x50,0x3c,0xff,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0xff,0xff,0xff,0xff,
+      0xff,0x7f,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x01,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x0f,0x00,0xc0,0xff,0xff,0xff },
+    { 0x3f,0xfc,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x0f,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0xf0,0x53,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x45,0x41,0x01,0x04,0x00,0x00,0x10,0x01,
+      0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x10,0x40,0x01,0x00,0x04,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x40,
+      0x00,0x44,0x05,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xc0,0xff,
+      0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x03,0x00,0x0c,0x00,0x00 },
+    { 0x00,0x03,0x00,0x55,0x55,0x55,0xd5,0xff,0xfd,0xff,0xff,0xff,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0xff,0x7f,0xff,0xff,0xff,0xff,0xd7,0xff,0xdf,0xf7,0x7f,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xff,0x3f,0x00,0x50,
+      0x00,0x00,0x50,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x55,0x55,0x55,0x55,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x50,0x15 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x40,0x00,0x41,0x00,0x00,0x00,0x40 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x14,0x00,0x00,0xff,0x7f,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0xff,0x3f,0x55,0x00,0x00,0x50,0x05,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x14,0x01,0x00,0x40,0x00,0x11,0x55,
+      0x45,0x15,0x11,0x01,0x41,0x14,0x11,0x11,0x41,0x14,0x40,0x00,0x40,0x00,0x01,0x44 },
+    { 0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x55,0x01,0x01,0x10,0x00,0x00,0x00,0x00,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x50,0x55,0x55,0x55 },
+    { 0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x00,0x00,0x00,0x40,0x01,0x00,0x00,0x00,
+      0x01,0x00,0x00,0x40,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x55,0x55 },
+    { 0xaa,0xaa,0x2a,0x00,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0xaa,0xaa,0xaa,0xaa,
+      0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0xaa,0x0a,0x00,0xaa,0xaa,0xaa,0xaa },
+    { 0xaa,0xaa,0xaa,0x9a,0x56,0x55,0x95,0xaa,0xaa,0xaa,0xaa,0x52,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x01,0x00,0x00,0x54,0x55,0x45,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x51 },
+    { 0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x15,0x40,0x55,0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x01,0x01,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,
+      0x51,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x41 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x05,
+      0x00,0x00,0x40,0x15,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x00,0x00,0x10,0x00 },
+    { 0x00,0x00,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x55 },
+    { 0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,
+      0x55,0x05,0x00,0x01,0x15,0x54,0x55,0x55,0x00,0x00,0x40,0x55,0x00,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x55,0x55,0x00,0x00,0x50,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 },
+    { 0x00,0x00,0x55,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x50,0x55,0x55,0x55,
+      0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x15,0x55,
+      0x55,0x45,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x00,0x00,0x00,0x55,0x55,0x55,0x00,0x00,0x00,0x50,0x55,0x55,0x55,0x55 },
+    { 0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+      0x00,0x00,0x40,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x55,0x00,0x00,0x50,0x55 },
+};
+
+/** Width class of code point cp.
+ */
+unsigned cons_uwidthClass(unsigned long cp) {
+    if (cp < 0x20000)
+        return (s_uwBlock[s_uwPage[cp >> 7]][(cp & 0x7f) >> 2] >> ((cp & 3) << 1)) & 3;
+    if (cp <= 0x3FFFD)
+        return CONS_UW_WIDE;        // CJK Ext. B and later.
+    if (cp == 0xE0001 || (cp >= 0xE0020 && cp <= 0xE007F) || (cp >= 0xE0100 && cp <= 0xE01EF))
+        return CONS_UW_ZERO;        // Tags, variation selectors.
+    if (cp >= 0xF0000 && cp <= 0x10FFFD)
+        return CONS_UW_AMBI;        // Private use.
+    return CONS_UW_NARROW;
+}
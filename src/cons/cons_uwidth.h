@@ -0,0 +1,22 @@
+/**
+ *  @file cons_uwidth.h
+ *  @brief East Asian Width of unicode code points.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Two-level table: code point >> 7 selects a block of 128 2-bit classes.
+ *   About 8KB. Used by the curses backend to measure UTF-8 strings once,
+ *   without the locale or wcwidth().
+ */
+#ifndef CONS_UWIDTH_H__
+#define CONS_UWIDTH_H__
+
+#define CONS_UW_NARROW          0   ///< 1 column.
+#define CONS_UW_WIDE            1   ///< 2 columns. East Asian Wide or Fullwidth.
+#define CONS_UW_AMBI            2   ///< East Asian Ambiguous. 1 or 2 columns by the terminal.
+#define CONS_UW_ZERO            3   ///< 0 column. Combining marks, format characters.
+
+unsigned cons_uwidthClass(unsigned long cp);
+
+#endif //CONS_UWIDTH_H__
@@ -80,6 +80,9 @@ static bool         s_play_draw_rq; ///< gamePlay での画面更新リクエス
 static cons_clock_t s_cur_time;     ///< 現在時間.
 static cons_clock_t s_start_time;   ///< ゲーム開始時刻.
 
+static int          s_replay_mode = CONS_REPLAY_OFF;    ///< 入力の記録/再生.
+static char const*  s_replay_path = NULL;               ///< 記録/再生ファイル名.
+
 /// セルをオープンする場所を貯めるキュー.
 typedef struct open_cell_que_t {
     uint8_t x,y;
@@ -99,9 +102,9 @@ static char         s_static_buf[MINE_MAP_MAX_W * MINE_MAP_MAX_H * 2];
 //  etc.
 
 /// 乱数初期化.
-///
+/// 再生時は記録した種を使う.
 static void rand_init(void) {
-    srand((unsigned int)time(NULL));
+    srand((unsigned int)cons_replayOpen(s_replay_mode, s_replay_path, (unsigned long)time(NULL)));
 }
 
 /// 0～(n-1) を生成する乱数.
@@ -293,6 +296,8 @@ static uint8_t  gameStart(void);
 static uint8_t  gamePlay(void);
 static uint8_t  gameWin(void);
 static uint8_t  gameOver(void);
+static void     draw_init(void);
+static void     draw_term(void);
 static void     draw_game(uint8_t state);
 
 /// ゲーム・メイン処理.
@@ -301,10 +306,11 @@ int gameMain(void) {
     int state = GAME_EXIT;
     int next  = GAME_TITLE;
 
+    rand_init();
+
     if (!cons_init(CONSINIT_FLAGS))
         return 1;
-
-    rand_init();
+    draw_init();
 
     // ゲームループ.
     do {
@@ -312,6 +318,7 @@ int gameMain(void) {
         cons_updateBegin();
 
         // ステート遷移.
+        cons_traceBegin("gameUpdate");
         if (state != next)
             s_step = 0;
         state = next;
@@ -345,13 +352,17 @@ int gameMain(void) {
         default:
             break;
         }
+        cons_traceEnd("gameUpdate");
 
         // 描画.
+        cons_traceBegin("draw_game");
         draw_game(state);
+        cons_traceEnd("draw_game");
 
         cons_updateEnd();
-    } while (next != GAME_EXIT);
+    } while (next != GAME_EXIT && !cons_replayEnd());
 
+    draw_term();
     cons_term();
     return 0;
 }
@@ -413,7 +424,9 @@ uint8_t gamePlay_open(void) {
         if (mine_cellValue(cell) == MINE_CELL_BOMB) {
             return 0;       // 爆発.
         } else if (mine_isClosed(cell)) {
+            cons_traceBegin("mine_openCell");
             mine_openCell(cx, cy);
+            cons_traceEnd("mine_openCell");
             if (mine_checkClear()) {    // 勝利判定.
                 return 2;   // 勝利.
             }
@@ -631,6 +644,40 @@ static uint8_t          s_draw_prev_state;
 static uint8_t          s_draw_state;
 static uint8_t          s_draw_map_level;
 
+/// 登録しておく固定文字列(グリフ).
+enum {
+    GLY_EMPTY, GLY_CELL_CUR, GLY_CELL, GLY_FLAG, GLY_BOMB, GLY_WALL_3, GLY_WALL_4,
+    GLY_DIGIT_1, GLY_NUM = GLY_DIGIT_1 + 8
+};
+static cons_glyph_t     s_gly[GLY_NUM];
+
+static cons_surface_t   s_frame;        ///< 外枠のレイヤー. 中は透明(CONS_CELL_NONE).
+static pos_t            s_frame_w;      ///< s_frame を描いた時のマップ横幅. 0 なら未作成.
+static pos_t            s_frame_h;      ///< s_frame を描いた時のマップ縦幅.
+static cons_col_t       s_frame_col;    ///< s_frame を描いた時の色.
+
+/// 描画初期化. 毎フレーム描く固定文字列をグリフとして登録しておく.
+///
+static void draw_init(void) {
+    uint_t i;
+    s_gly[GLY_EMPTY]    = cons_glyphRegister(STR_EMPTY);
+    s_gly[GLY_CELL_CUR] = cons_glyphRegister(STR_CELL_CUR);
+    s_gly[GLY_CELL]     = cons_glyphRegister(STR_CELL);
+    s_gly[GLY_FLAG]     = cons_glyphRegister(STR_FLAG);
+    s_gly[GLY_BOMB]     = cons_glyphRegister(STR_BOMB);
+    s_gly[GLY_WALL_3]   = cons_glyphRegister(STR_WALL_3);
+    s_gly[GLY_WALL_4]   = cons_glyphRegister(STR_WALL_4);
+    for (i = 0; i < 8; ++i)
+        s_gly[GLY_DIGIT_1 + i] = cons_glyphRegister(str_digits[i]);
+}
+
+/// 描画終了. 外枠のレイヤーを解放する.
+///
+static void draw_term(void) {
+    cons_surfaceTerm(&s_frame);
+    s_frame_w = 0;
+}
+
 /// 文字列コピー. 最後のアドレスを返す.
 ///
 static char* stpCpyE(char* dst, char* dst_e, char const* src) {
@@ -661,7 +708,7 @@ static void draw_status(void) {
 
     if (s_play_draw_rq || s_draw_state != s_draw_prev_state) {
         uint_t   f_num = s_bomb_total - s_flag_count;
-        cons_xycprintf(x, y, COL_FLAG, "%s", STR_FLAG);
+        cons_putGlyph(x, y, COL_FLAG, s_gly[GLY_FLAG]);
         cons_xycprintf(x+3, y, COL_DEFAULT, "%2u", f_num);
         cons_setRefreshRect(1, x, y, w, 1);     // フラグ・時計範囲描画更新.
     } else {
@@ -681,43 +728,58 @@ static void draw_status(void) {
     }
 }
 
-/// 外枠描画.
+/// 外枠をレイヤーに描く. 左上の角が原点.
 ///
-static void draw_frame(pos_t x, pos_t y, pos_t w, pos_t h) {
+static void draw_initFrame(pos_t w, pos_t h, cons_col_t co) {
     enum { buf_sz = 6 * (MINE_MAP_MAX_W + 2) + 1 };
     char   buf[ buf_sz ];
     char*  d = buf;
     char*  e = d + buf_sz;
     pos_t  x2,y2;
     uint_t i;
-    cons_col_t co = COL_WALL;
-    if (s_draw_state == GAME_OVER)  //ゲームオーバー時は外枠の色を赤に.
-        co = COL_BOMB;
 
-    x -= SCR_X_SCALE(1);
+    s_frame_w = 0;
+    cons_surfaceTerm(&s_frame);
+    if (!cons_surfaceInit(&s_frame, SCR_X_SCALE(w+2), h+2))
+        return;
+
     d = stpCpyE(d, e, STR_WALL_0);
-    i = s_map_w;
+    i = w;
     do {
         d = stpCpyE(d, e, STR_WALL_1);
     } while (--i);
     d = stpCpyE(d, e, STR_WALL_2);
-    cons_xycputs(x, y-1, co, buf);
+    cons_surfacePuts(&s_frame, 0, 0, co, buf);
 
     d = buf;
     d = stpCpyE(d, e, STR_WALL_5);
-    i = s_map_w;
+    i = w;
     do {
         d = stpCpyE(d, e, STR_WALL_6);
     } while (--i);
     d = stpCpyE(d, e, STR_WALL_7);
-    cons_xycputs(x, y+h, co, buf);
+    cons_surfacePuts(&s_frame, 0, h+1, co, buf);
 
     // 左右.
-    x2 = x + SCR_X_SCALE(w+1);
-    for (y2 = y; y2 < y+h; ++y2) {
-        cons_xycputs( x, y2, co, STR_WALL_3);
-        cons_xycputs(x2, y2, co, STR_WALL_4);
+    x2 = SCR_X_SCALE(w+1);
+    for (y2 = 1; y2 <= h; ++y2) {
+        cons_surfacePutGlyph(&s_frame,  0, y2, co, s_gly[GLY_WALL_3]);
+        cons_surfacePutGlyph(&s_frame, x2, y2, co, s_gly[GLY_WALL_4]);
     }
+    s_frame_w   = w;
+    s_frame_h   = h;
+    s_frame_col = co;
+}
+
+/// 外枠描画. マップサイズか色が変わった時だけレイヤーを描き直し、それを転送する.
+///
+static void draw_frame(pos_t x, pos_t y, pos_t w, pos_t h) {
+    cons_col_t co = COL_WALL;
+    if (s_draw_state == GAME_OVER)  //ゲームオーバー時は外枠の色を赤に.
+        co = COL_BOMB;
+    if (w != s_frame_w || h != s_frame_h || co != s_frame_col)
+        draw_initFrame(w, h, co);
+    cons_blit(NULL, x - SCR_X_SCALE(1), y - 1, &s_frame, NULL);
 }
 
 /// マップ表示.
@@ -745,21 +807,21 @@ static void draw_map(void) {
             uint8_t val  = mine_cellValue(cell);
             if (mine_isClosed(cell)) {  // 閉じてる.
                 if (mine_isFlagged(cell)) {
-                    cons_xycputs(x1, y1, COL_FLAG, STR_FLAG);
+                    cons_putGlyph(x1, y1, COL_FLAG, s_gly[GLY_FLAG]);
                 } else {
-                    cons_xycputs(x1, y1, COL_CELL, STR_CELL);
+                    cons_putGlyph(x1, y1, COL_CELL, s_gly[GLY_CELL]);
                 }
             } else {    // 開いてる.
                 if (val >= MINE_CELL_BOMB) {
-                    cons_xycputs(x1, y1, COL_BOMB, STR_BOMB);
+                    cons_putGlyph(x1, y1, COL_BOMB, s_gly[GLY_BOMB]);
                 } else if (val == 0) {
-                    cons_xycputs(x1, y1, COL_EMPTY, STR_EMPTY);
+                    cons_putGlyph(x1, y1, COL_EMPTY, s_gly[GLY_EMPTY]);
                 } else {
                     uint8_t co;
                     if (val == 1)      co = COL_NUMBER_1;
                     else if (val == 2) co = COL_NUMBER_2;
                     else               co = COL_NUMBER_3_TO_8;
-                    cons_xycputs(x1, y1, co, str_digits[val-1]);
+                    cons_putGlyph(x1, y1, co, s_gly[GLY_DIGIT_1 + val-1]);
                 }
             }
             x1 += SCR_X_SCALE(1);
@@ -772,7 +834,7 @@ static void draw_map(void) {
 void draw_cursor(void) {
     pos_t x = s_draw_map_ofs_x + SCR_X_SCALE(s_cursor_x);
     pos_t y = s_draw_map_ofs_y + s_cursor_y;
-    cons_xycputs(x, y, COL_CELL_CUR, STR_CELL_CUR);
+    cons_putGlyph(x, y, COL_CELL_CUR, s_gly[GLY_CELL_CUR]);
 }
 
 
@@ -950,6 +1012,18 @@ void draw_game(uint8_t state) {
 
 /// main
 ///
-int main(void) {
+int main(int argc, char* argv[]) {
+    int i;
+    for (i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "-rec", 4) == 0) {         // 入力を記録.
+            s_replay_mode = CONS_REPLAY_RECORD;
+            s_replay_path = argv[i][4] ? argv[i]+4 : "mines.rep";
+        } else if (strncmp(argv[i], "-play", 5) == 0) { // 記録した入力を再生.
+            s_replay_mode = CONS_REPLAY_PLAY;
+            s_replay_path = argv[i][5] ? argv[i]+5 : "mines.rep";
+        } else if (strncmp(argv[i], "-trace", 6) == 0) { // フレームの時間経過を記録.
+            cons_traceOpen(argv[i][6] ? argv[i]+6 : "mines.json", 0);
+        }
+    }
     return gameMain();
 }
@@ -9,34 +9,25 @@
  */
 
 #include "cons/cons.h"
+#include "otitame_core.h"
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
-#if __STDC_VERSION__ >= 199901L || __cplusplus >= 201103L
- #include <stdint.h>
- #if !defined(__cplusplus)
-  #include <stdbool.h>
- #endif
-#else
-typedef unsigned char   uint8_t;
-typedef unsigned short  uint16_t;
-typedef unsigned char   bool;
-#endif
 
-#if defined(CONS_CURSES)
+#if defined(CONS_CURSES) || defined(CONS_SERVER)
 #define USE_SELECT_PIECE
 #endif
-//#define MOTO_GAME
 
 //  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
 //  etc
 
-typedef unsigned int    uint_t;
-typedef cons_pos_t      pos_t;
-
-#define FIELD_W         10
-#define FIELD_H         20
+#if defined(CONS_REFRESH_RECT_N)
+#define BOARD_MAX       CONS_REFRESH_RECT_N ///< 同時プレイできる盤面の最大数.
+#else
+#define BOARD_MAX       16
+#endif
 
 #if 0 //defined(__PCAT__)
 #define CONSINIT_FLAGS  1
@@ -44,188 +35,9 @@ typedef cons_pos_t      pos_t;
 #define CONSINIT_FLAGS  0
 #endif
 
-//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
-//  PIECE
-
-#define PIECE_SHAPE_NUM   7     ///< ピース形状の種類数.
-
-/// ピース形状 （7種類 × 4回転） src/tool/gen_shape.cpp
-static uint16_t const piece_shapes[PIECE_SHAPE_NUM][4] = {
-    //  0       90     180     270
-    { 0x0660, 0x0660, 0x0660, 0x0660, },    // ■ O
-    { 0x0c60, 0x2640, 0x0c60, 0x2640, },    // z  Z
-    { 0x06c0, 0x4620, 0x06c0, 0x4620, },    // s  S
-    { 0x8e00, 0x6440, 0x0e20, 0x44c0, },    // ┛ J
-    { 0x2e00, 0x4460, 0x0e80, 0xc440, },    // ┗ L
-    { 0x04e0, 0x4640, 0x0e40, 0x4c40, },    // ┻ T
-    { 0x0f00, 0x2222, 0x0f00, 0x4444, },    // ┃ I
-};
-
-typedef struct Piece {
-    pos_t       x;              ///< Field 内x位置.
-    pos_t       y;              ///< Field 内y位置.
-    uint8_t     shape;          ///< 形状 shape 種類(0〜6)
-    uint8_t     r;              ///< 回転 rotate (0:0,1:90,2:180,3:270)
-} Piece;
-
-static Piece   s_piece_cur;     ///< 現在のピース.
-static Piece   s_piece_next;    ///< 次のピース.
-
-/// ピース初期化.
-///
-static void piece_init(Piece* p) {
-    uint_t i;
-    do {    // PIECE_SHAPE_NUM=7 に依存した 0..6乱数生成.
-        i = rand();
-        i = (i >> (14-3)) & 7;
-    } while (i == 7);
-    p->x     = (FIELD_W / 2) - 2;
-    p->y     = -1;              // 各ピース 0°は上1行空白なので詰める.
-    p->r     = 0;
-    p->shape = i;
-}
-
-
-//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
-//  FIELD
-
-typedef uint8_t         field_t;
-static field_t          s_field[FIELD_H][FIELD_W];
-
-#define field_get(x,y)  (s_field[y][x])
-
-/// フィールド・クリア.
-///
-static void field_clear(void) {
-    memset(s_field, 0, sizeof(s_field));
-}
-
-/// ピースを置けるか?
-///
-static bool field_canPlacePiece(Piece const* p) {
-    uint16_t ptn = piece_shapes[p->shape][p->r];
-    pos_t    x0  = p->x, y0 = p->y;
-    uint8_t  i;
-    for (i = 0; i < 16; ++i) {
-        pos_t y = y0 + (i >> 2);
-        if (y >= 0) {
-            field_t const* field = s_field[y];
-            if (ptn & (0x8000 >> i)) {
-                pos_t x = x0 + (i &  3);
-                if (x < 0 || x >= FIELD_W || y >= FIELD_H || field[x])
-                    return 0;
-            }
-        }
-    }
-    return 1;
-}
-
-/// ピースの固定.
-///
-static void field_placePiece(Piece const* p) {
-    uint16_t ptn = piece_shapes[p->shape][p->r];
-    pos_t    x0  = p->x, y0 = p->y;
-    uint8_t  i;
-    for (i = 0; i < 16; ++i) {
-        if (ptn & (0x8000 >> i)) {
-            pos_t x = x0 + (i &  3);
-            pos_t y = y0 + (i >> 2);
-            if (y >= 0 && y < FIELD_H && x >= 0 && x < FIELD_W)
-                s_field[y][x] = p->shape + 1;
-        }
-    }
-}
-
-#if !defined(MOTO_GAME)
-
-/// 行が揃ったか?
-/// @return 今回揃ったライン数.
-static uint8_t filed_checkReach() {
-    uint8_t lines = 0;
-    pos_t   x,  y = FIELD_H;
-    while (--y >= 0) {
-        field_t* field = s_field[y];
-        for (x = 0; x < FIELD_W; ++x) {
-            field_t f = field[x];
-            if (!f || (f & 0x8)) {
-                field = NULL;
-                break;
-            }
-        }
-        if (field) {
-            for (x = 0; x < FIELD_W; ++x)
-                field[x] |= 8;
-            ++lines;
-        }
-    }
-    return lines;
-}
-
-/// ライン消去.
-/// @return 消去したライン数.
-static uint8_t filed_clearLines() {
-    uint8_t lines = 0;
-    pos_t   x,  y = FIELD_H, prev_y = FIELD_H;
-    while (--y >= 0) {
-        field_t* field = s_field[y];
-        if (lines == 0)
-            ;
-        else if (y != prev_y)
-            break;
-        for (x = 0; x < FIELD_W; ++x) {
-            field_t f = field[x];
-            if (!(f & 0x8)) {
-                field = NULL;
-                break;
-            }
-        }
-        if (field) {
-            pos_t y2 = y;
-            while (--y2 >= 0)
-                memcpy(s_field[y2+1], s_field[y2], FIELD_W * sizeof(field_t));
-            memset(s_field[0], 0, FIELD_W * sizeof(field_t));
-            ++lines;
-            prev_y = y;
-            ++y;
-        }
-    }
-    return lines;
-}
-
-#else   // MOTO_GAME
-
-/// 元ゲー:ライン消去.
-/// @return 消去したライン数.
-static uint8_t filed_clearLinesMoto(void) {
-    uint8_t lines = 0;
-    pos_t   x,  y = FIELD_H;
-    while (--y >= 0) {
-        field_t* field1 = s_field[y];
-        for (x = 0; x < FIELD_W; ++x) {
-            if (!field1[x]) {
-                field1 = NULL;
-                break;
-            }
-        }
-        if (field1) {
-            pos_t y2 = y;
-            while (--y2 >= 0)
-                memcpy(s_field[y2+1], s_field[y2], FIELD_W * sizeof(field_t));
-            memset(s_field[0], 0, FIELD_W * sizeof(field_t));
-            ++lines;
-            ++y;
-        }
-    }
-    return lines;
-}
-#endif
-
-
 //  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
 //  GAME
 
-#define GAME_MIN_SPEED   CONS_MSEC_TO_CLOCK(50)  ///< 最小速度(ミリ秒)
-
 typedef enum GameState {
     GAME_EXIT   = 0,
     GAME_TITLE  = 1,
@@ -234,19 +46,55 @@ typedef enum GameState {
     GAME_OVER   = 4,
 } GameState;
 
-static GameState s_cur_state  = GAME_TITLE; ///< 現在のステート.
-static GameState s_next_state = GAME_TITLE; ///< 次回のステート.
-static GameState s_prev_state = GAME_EXIT;  ///< 前回のステート.
-
-static cons_clock_t s_fall_time= 0;         ///< 次の落下予定時間.
-static uint_t   s_lines       = 0;          ///< クリアしたライン数.
-static uint_t   s_pre_lines   = 0;          ///< 揃ったライン数.
-static uint_t   s_level       = 1;          ///< レベル.
-static uint_t   s_score       = 0;          ///< スコア.
+/// プレイヤー. 盤面1つ分の時間と表示の管理.
+typedef struct Player {
+    Board        board;             ///< 盤面.
+    cons_clock_t fall_time;         ///< 次の落下予定時間.
+    uint8_t      draw_flags;        ///< 盤面の描画フラグ.
+    pos_t        draw_x;            ///< フィールドの表示位置x.
+    pos_t        draw_y;            ///< フィールドの表示位置y.
+} Player;
+
+/// 描画する欠片の文字列(グリフ).
+enum { GLY_SPC, GLY_P_FIX, GLY_P_FALL, GLY_P_REACH, GLY_WALL, GLY_NUM };
+
+/// 1人分のゲームの状態. 通常は s_game の1つだけ.
+/// サーバ(CONS_SERVER)では接続ごとに持ち、フレームごとに s_g を切り替える.
+typedef struct Game {
+    GameState       cur_state;          ///< 現在のステート.
+    GameState       next_state;         ///< 次回のステート.
+    GameState       prev_state;         ///< 前回のステート.
+    uint8_t         step;               ///< そのステートでのstep.
+    uint8_t         choise;             ///< 選択子番号.
+    uint8_t         draw_flags;         ///< 描画フラグ(DrawFlag).
+    Piece           title_piece;        ///< タイトルで回すピース.
+    cons_clock_t    title_time;         ///< タイトルのピース変更時間.
+ #if defined(USE_SELECT_PIECE)
+    struct PieceParts const* piece_parts;   ///< 欠片のスタイル.
+    struct PieceParts const* gly_parts;     ///< gly[] を登録したスタイル.
+    uint8_t         field_shift_x;      ///< フィールド座標->コンソール座標 変換シフト数.
+    uint8_t         piece_stype;        ///< ピースの表示スタイル.
+ #endif
+    cons_glyph_t    gly[GLY_NUM];       ///< 欠片のグリフ.
+    cons_surface_t  layer;              ///< 固定表示物(壁・情報項目・ヘルプ)のレイヤー. グリフと一緒に作り直す.
+    Player          players[BOARD_MAX]; ///< 盤面ごとのプレイヤー. 最後に置く(サーバは s_board_num 個分だけ確保).
+} Game;
+
+static Game     s_game;                     ///< ゲームの状態.
+static Game*    s_g           = &s_game;    ///< 現在のゲームの状態.
+static uint8_t  s_board_num   = 1;          ///< 同時プレイする盤面数.
+static pos_t    s_field_w     = FIELD_W;    ///< フィールド横幅.
+static pos_t    s_field_h     = FIELD_H;    ///< フィールド縦幅.
+static uint8_t  s_rand_policy = PIECE_RAND_UNIFORM; ///< ピースの選び方.
+static uint32_t s_rand_seed   = 0;          ///< 乱数の種. 0 なら毎回変える.
+static uint8_t  s_preview_num = 1;          ///< 表示する次のピースの数.
+static uint8_t  s_scr_flags   = 0;          ///< cons_init に追加するフラグ(PC-AT の行数・桁数).
 static uint_t   s_high_score  = 0;          ///< ハイスコア.
-static uint_t   s_speed       = 0;          ///< 落下速度.
-static uint8_t  s_step        = 0;          ///< そのステートでのstep.
-static uint8_t  s_choise      = 0;          ///< 選択子番号.
+static int      s_replay_mode = CONS_REPLAY_OFF;    ///< 入力の記録/再生.
+static char const* s_replay_path = NULL;    ///< 記録/再生ファイル名.
+#if defined(CONS_SERVER)
+static char const* s_listen_addr = "2626";  ///< 待ち受けるアドレス. "port" "host:port" "unix:path".
+#endif
 
 typedef enum DrawFlag {
     DRAWF_FIELD = 0x01,
@@ -256,21 +104,16 @@ typedef enum DrawFlag {
     DRAWF_OVER  = 0x10,
     DRAWF_ALL   = 0x1F,
 } DrawFlag;
-static uint8_t  s_draw_flags  = 0;
 
 static bool     gameUpdate(void);
 static bool     gameTitle(void);
 static bool     gameStart(void);
 static bool     gamePlay(void);
+static bool     player_play(Player* p, uint8_t k, cons_clock_t cur_time);
 static uint8_t  gameOver(void);
-#if !defined(MOTO_GAME)
-static void     pieceLand(void);
-static void     pieceClear(void);
-#else
-static void     pieceLandMoto(void);
-#endif
-static void     checkLevelUp(void);
+static uint_t   bestScore(void);
 static void     draw_gameUpdate(void);
+static void     game_init(void);
 #if defined(USE_SELECT_PIECE)
 static void     select_piece_init(int piece_stype);
 #endif
@@ -292,47 +135,98 @@ static uint8_t getKey(void) {
     }
 }
 
+#if defined(CONS_SERVER)
+/// サーバ: 接続時. st は0クリア済のセッションごとの Game.
+///
+static void server_init(void* st) {
+    s_g = (Game*)st;
+    cons_init(CONSINIT_FLAGS | s_scr_flags);
+    game_init();
+    s_g = &s_game;
+}
+
+/// サーバ: セッションの1フレーム.
+/// @return  0:切断 1:継続.
+static int server_frame(void* st) {
+    bool rc;
+    s_g = (Game*)st;
+    cons_traceBegin("gameUpdate");
+    rc  = gameUpdate();
+    cons_traceEnd("gameUpdate");
+    cons_traceBegin("draw_gameUpdate");
+    draw_gameUpdate();
+    cons_traceEnd("draw_gameUpdate");
+    s_g = &s_game;
+    return rc;
+}
+
+/// サーバ: 切断時.
+///
+static void server_term(void* st) {
+    cons_surfaceTerm(&((Game*)st)->layer);
+}
+
+/// サーバ・メイン. 接続ごとに Game を持ち、ループは cons_serverMain に任せる.
+/// @return osへ返す値. 0:正常終了. 1:エラー終了.
+static int gameMain(void) {
+    cons_serverApp_t app;
+    srand((unsigned)time(NULL));
+    app.state_size = (unsigned)(offsetof(Game, players) + s_board_num * sizeof(Player));
+    app.init       = server_init;
+    app.frame      = server_frame;
+    app.term       = server_term;
+    return cons_serverMain(s_listen_addr, CONSINIT_FLAGS | s_scr_flags, &app);
+}
+#else
 /// ゲーム・メインループ.
 /// @return osへ返す値. 0:正常終了. 1:エラー終了.
 static int gameMain(void) {
     bool rc = 0;
-    srand((int)time(NULL));         // 乱数初期化.
-    if (!cons_init(CONSINIT_FLAGS)) // cons:コンソール画面初期化.
+    // 乱数初期化. 再生時は記録した種を使う.
+    srand((unsigned)cons_replayOpen(s_replay_mode, s_replay_path, (unsigned long)time(NULL)));
+    if (!cons_init(CONSINIT_FLAGS | s_scr_flags))   // cons:コンソール画面初期化.
         return 1;
+    game_init();
     do {
         cons_updateBegin();         // cons:画面の毎フレームの開始処理.
+        cons_traceBegin("gameUpdate");
         rc = gameUpdate();          // ゲームの毎フレームの更新.
+        cons_traceEnd("gameUpdate");
+        cons_traceBegin("draw_gameUpdate");
         draw_gameUpdate();          // ゲーム描画の毎フレームの更新.
+        cons_traceEnd("draw_gameUpdate");
         cons_updateEnd();           // cons:画面の毎フレーム終わりの処理.
-    } while (rc);
+    } while (rc && !cons_replayEnd());
+    cons_surfaceTerm(&s_g->layer);
     cons_term();                    // cons:コンソール画面終了処理.
     return 0;
 }
+#endif
 
 /// ゲームの毎フレームの更新.
 /// @return  0:終了 1:継続.
 static bool gameUpdate(void) {
     uint8_t rc = 0;
-    s_prev_state = s_cur_state;
-    s_cur_state  = s_next_state;
-    if (s_cur_state != s_prev_state)
-        s_step = 0;
-    switch (s_cur_state) {
+    s_g->prev_state = s_g->cur_state;
+    s_g->cur_state  = s_g->next_state;
+    if (s_g->cur_state != s_g->prev_state)
+        s_g->step = 0;
+    switch (s_g->cur_state) {
     case GAME_TITLE:
         if (gameTitle() == 0)
-            s_next_state = GAME_START;
+            s_g->next_state = GAME_START;
         break;
     case GAME_START:
         if (gameStart() == 0)
-            s_next_state = GAME_PLAY;
+            s_g->next_state = GAME_PLAY;
         break;
     case GAME_PLAY:
         if (gamePlay() == 0)
-            s_next_state = GAME_OVER;
+            s_g->next_state = GAME_OVER;
         break;
     case GAME_OVER:
         rc = gameOver();
-        s_next_state = (rc == 0) ? GAME_EXIT
+        s_g->next_state = (rc == 0) ? GAME_EXIT
                      : (rc == 1) ? GAME_OVER
                      : (rc == 2) ? GAME_START
                      :             GAME_TITLE;
@@ -348,20 +242,20 @@ static bool gameUpdate(void) {
 static bool gameTitle(void) {
     cons_key_t   k        = cons_key();
     cons_clock_t cur_time = cons_clock();
-    if (s_step < 255) {
-        if (s_step < 6)
+    if (s_g->step < 255) {
+        if (s_g->step < 6)
             k = CONS_KEY_ERR;
-        ++s_step;
+        ++s_g->step;
     }
-    if (s_fall_time <= cur_time) { // 時間でピース変更.
-        s_fall_time = cur_time + 12*GAME_MIN_SPEED;
-        if (++s_piece_cur.shape > 6) {
-            s_piece_cur.shape = 0;
-            s_piece_cur.r     = (s_piece_cur.r + 1) & 3;
+    if (s_g->title_time <= cur_time) { // 時間でピース変更.
+        s_g->title_time = cur_time + CONS_MSEC_TO_CLOCK(12*GAME_MIN_SPEED);
+        if (++s_g->title_piece.shape > 6) {
+            s_g->title_piece.shape = 0;
+            s_g->title_piece.r     = (s_g->title_piece.r + 1) & 3;
         }
     }
     rand();                     // 適当に乱数更新.
-    s_draw_flags = DRAWF_ALL;
+    s_g->draw_flags = DRAWF_ALL;
  #if defined(USE_SELECT_PIECE)
     if (k == 'C' || k == 'c') {
         select_piece_init(-2);
@@ -374,166 +268,137 @@ static bool gameTitle(void) {
 /// ゲーム開始.
 /// @return  0:終了 1:継続.
 static bool gameStart(void) {
-    ++s_step;
-    if (s_step == 1) {
-        field_clear();
+    uint8_t i;
+    ++s_g->step;
+    if (s_g->step == 1) {
+        uint32_t seed = s_rand_seed;
+        if (seed == 0)
+            seed = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
      #if defined(USE_SELECT_PIECE)
         select_piece_init(-1);
      #endif
-        piece_init(&s_piece_cur);       // 最初のピースを用意.
-        piece_init(&s_piece_next);      // 次のピースを用意.
-        s_lines     = 0;
-        s_pre_lines = 0;
-        s_level     = 1;
-        s_speed     = 10*GAME_MIN_SPEED;
-        s_score     = 0;
-    } else if (s_step > 13) {
-        s_step      = 0;
-        s_fall_time = cons_clock() + s_speed;
+        for (i = 0; i < s_board_num; ++i) {
+            board_init(&s_g->players[i].board, s_field_w, s_field_h
+                        , s_rand_policy, prand_seed(seed, i));
+        }
+    } else if (s_g->step > 13) {
+        s_g->step      = 0;
+        for (i = 0; i < s_board_num; ++i) {
+            Player* p = &s_g->players[i];
+            p->fall_time = cons_clock() + CONS_MSEC_TO_CLOCK(p->board.speed);
+        }
         return 0;
     }
     return 1;
 }
 
 /// ゲームプレイ.
+/// 全盤面に同じキー入力を与える.
 /// @return  0:終了 1:継続.
 static bool gamePlay(void) {
- #if !defined(MOTO_GAME)
-    bool         clear_rq = 0;
- #endif
     cons_clock_t cur_time = cons_clock();
     uint8_t      k        = getKey();
+    bool         alive    = 0;
+    uint8_t      i;
+
+    s_g->draw_flags = 0;
+    if (k == key_cancel)
+        return 0;   // 強制終了.
+    for (i = 0; i < s_board_num; ++i) {
+        Player* p = &s_g->players[i];
+        p->draw_flags = 0;
+        if (!p->board.over && player_play(p, k, cur_time))
+            alive = 1;
+        else
+            p->board.over = 1;
+    }
+    if (s_high_score < bestScore())
+        s_high_score = bestScore();
+    return alive;
+}
 
-    s_draw_flags = 0; //DRAWF_FIELD;
+/// 盤面1つ分のプレイ.
+/// @return  0:GAME OVER 1:継続.
+static bool player_play(Player* p, uint8_t k, cons_clock_t cur_time) {
+    Board*       b = &p->board;
+ #if !defined(MOTO_GAME)
+    bool         clear_rq = 0;
+ #endif
 
-    if (s_piece_cur.y < 0) {
-        s_draw_flags |= DRAWF_FIELD | DRAWF_INFO | DRAWF_NEXT;
+    if (b->cur.y < 0) {
+        p->draw_flags |= DRAWF_FIELD | DRAWF_INFO | DRAWF_NEXT;
     }
 
     // 入力処理.
     if (k) {
-        Piece  cur = s_piece_cur;
         switch (k) {
-        case key_left : --cur.x; break;
-        case key_right: ++cur.x; break;
-        case key_down : ++cur.y; break;
-        case key_1    : cur.r = (cur.r + 1) & 3; break;
+        case key_left : board_move(b, -1, 0, 0); break;
+        case key_right: board_move(b, +1, 0, 0); break;
+        case key_down : board_move(b,  0, 1, 0); break;
+        case key_1    : board_move(b,  0, 0, 1); break;
       #if !defined(MOTO_GAME)
         case key_2    : clear_rq = 1; break;
       #endif
-        case key_cancel: return 0; // 強制終了.
         default: break;
         }
-        if (field_canPlacePiece(&cur))
-            s_piece_cur = cur;
-        s_draw_flags |= DRAWF_FIELD;
+        p->draw_flags |= DRAWF_FIELD;
     }
 
  #if !defined(MOTO_GAME)
     if (clear_rq) { // タメてた行をクリア.
-        pieceClear();
-        s_draw_flags |= DRAWF_FIELD | DRAWF_INFO;
+        cons_traceBegin("board_clear");
+        board_clear(b);
+        cons_traceEnd("board_clear");
+        p->draw_flags |= DRAWF_FIELD | DRAWF_INFO;
     }
-    if (s_lines < s_pre_lines) {
-        s_draw_flags |= DRAWF_FIELD;
+    if (b->lines < b->pre_lines) {
+        p->draw_flags |= DRAWF_FIELD;
     }
  #endif
 
     // 落下.
-    if (s_fall_time <= cur_time) {
-        Piece   cur = s_piece_cur;
-        s_fall_time = cur_time + s_speed;
-        s_draw_flags |= DRAWF_FIELD;
-        ++cur.y;
-        if (field_canPlacePiece(&cur)) {    // 落下できる?
-            ++s_piece_cur.y;
-        } else {    // 着地.
-            s_draw_flags |= DRAWF_INFO;
-            field_placePiece(&s_piece_cur);
-         #if !defined(MOTO_GAME)
-            pieceLand();
-         #else
-            pieceLandMoto();
-         #endif
-            s_piece_cur = s_piece_next; // 次のピースをカレントに.
-            piece_init(&s_piece_next);  // 新しい次のピースを用意.
-            if (!field_canPlacePiece(&s_piece_cur))
-                return 0;   // 出現場所で衝突 → GAME OVER.
+    if (p->fall_time <= cur_time) {
+        p->fall_time = cur_time + CONS_MSEC_TO_CLOCK(b->speed);
+        p->draw_flags |= DRAWF_FIELD;
+        switch (board_fall(b)) {
+        case BOARD_LAND:    // 着地.
+            p->draw_flags |= DRAWF_INFO;
+            break;
+        case BOARD_OVER:    // 出現場所で衝突 → GAME OVER.
+            p->draw_flags |= DRAWF_INFO;
+            return 0;
+        default:
+            break;
         }
     }
+    cons_wakeAt(p->fall_time);  // サーバには次の落下時間に起こしてもらう.
     return 1;
 }
 
-#if !defined(MOTO_GAME)
-
-/// 着地処理.
-///
-static void pieceLand(void) {
-    uint8_t reached = filed_checkReach();
-    if (reached > 0) {
-        s_pre_lines += reached;
-        s_score += reached * reached;
-        if (s_high_score < s_score)
-            s_high_score = s_score;
-    }
-}
-
-/// ピース・クリア.
+/// 全盤面中の最高スコア.
 ///
-static void pieceClear(void) {
-    uint8_t cleared = filed_clearLines();
-    if (cleared > 0) {
-        uint8_t i;
-        s_lines += cleared;
-        for (i = 1; i <= cleared; ++i)
-            s_score += i;
-        if (s_high_score < s_score)
-            s_high_score = s_score;
-        checkLevelUp();         // レベルアップ.
-    }
-}
-
-#else // defined(MOTO_GAME)
-
-/// 元ゲー:着地処理.
-///
-static void pieceLandMoto(void) {
-    uint8_t cleared = filed_clearLinesMoto();
-    if (cleared > 0) {
-        s_lines  += cleared;
-        s_score  += cleared*cleared;
-        if (s_high_score < s_score)
-            s_high_score = s_score;
-        checkLevelUp();         // レベルアップ.
-    }
-}
-
-#endif
-
-/// レベルアップ・チェック.
-///
-static void checkLevelUp(void) {
-    uint_t  new_level = s_lines / 10 + 1;
-    if (s_level < new_level) {
-        s_level   = new_level;
-        s_speed   = (s_speed > 2*GAME_MIN_SPEED)
-                  ? (s_speed - GAME_MIN_SPEED)
-                  : GAME_MIN_SPEED;
-    }
+static uint_t bestScore(void) {
+    uint_t  score = 0;
+    uint8_t i;
+    for (i = 0; i < s_board_num; ++i) {
+        if (score < s_g->players[i].board.score)
+            score = s_g->players[i].board.score;
+    }
+    return score;
 }
 
 /// ゲームオーバー.
 /// @return 1=処理中 2=リトライ 3=title 0=終了.
 static uint8_t gameOver(void) {
-    if (s_step == 0) {
-        s_choise = 0;
-        ++s_step;
+    if (s_g->step == 0) {
+        s_g->choise = 0;
+        ++s_g->step;
     } else {
         uint8_t k = getKey();
-        s_choise  = (s_choise + 3 - (k == key_left) + (k == key_right)) % 3;
+        s_g->choise  = (s_g->choise + 3 - (k == key_left) + (k == key_right)) % 3;
         if (k == key_1 || k == key_2) {
             static uint8_t const rets[3] = { 2, 3, 0 };
-            return rets[s_choise];
+            return rets[s_g->choise];
         } else if (k == key_cancel) {
             return 0;   // ESC は強制終了.
         }
@@ -642,15 +507,15 @@ static uint8_t gameOver(void) {
 
 #else   // USE_SELECT_PIECE ピース・スタイル選択可能.(デバッグ向き)
 
-#define STR_SPC                     (s_piece_parts->part[0])
-#define STR_P_FIX                   (s_piece_parts->part[1])
-#define ATR_P_FIX                   (s_piece_parts->colofs[1-1])
-#define STR_P_FALL                  (s_piece_parts->part[2])
-#define ATR_P_FALL                  (s_piece_parts->colofs[2-1])
-#define STR_P_REACH                 (s_piece_parts->part[3])
-#define ATR_P_REACH                 (s_piece_parts->colofs[3-1])
-#define STR_WALL                    (s_piece_parts->part[4])
-#define FIELD_SCALE_X(x)            ((x) << s_field_shift_x)
+#define STR_SPC                     (s_g->piece_parts->part[0])
+#define STR_P_FIX                   (s_g->piece_parts->part[1])
+#define ATR_P_FIX                   (s_g->piece_parts->colofs[1-1])
+#define STR_P_FALL                  (s_g->piece_parts->part[2])
+#define ATR_P_FALL                  (s_g->piece_parts->colofs[2-1])
+#define STR_P_REACH                 (s_g->piece_parts->part[3])
+#define ATR_P_REACH                 (s_g->piece_parts->colofs[3-1])
+#define STR_WALL                    (s_g->piece_parts->part[4])
+#define FIELD_SCALE_X(x)            ((x) << s_g->field_shift_x)
 
 typedef struct PieceParts {
     uint8_t     shift_x;    ///< フィールド座標->コンソール座標 変換シフト数.
@@ -669,27 +534,38 @@ static PieceParts  const piece_parts_tbl[] = {
 };
 enum { PiecePartsTbl_size = sizeof(piece_parts_tbl) / sizeof(piece_parts_tbl[0]) };
 
-static PieceParts const*    s_piece_parts   = &piece_parts_tbl[0];
-static uint8_t              s_field_shift_x = 0;
-static uint8_t              s_piece_stype   = 0;    ///< ピースの表示スタイル.
-
 /// ピース・スタイル設定.
 ///
 static void select_piece_init(int piece_stype) {
     if (piece_stype == -1)
-        piece_stype = s_piece_stype;
+        piece_stype = s_g->piece_stype;
     else if (piece_stype == -2)
-        piece_stype = s_piece_stype + 1;
+        piece_stype = s_g->piece_stype + 1;
     piece_stype     = piece_stype % PiecePartsTbl_size;
-    s_piece_stype   = piece_stype;
-    s_piece_parts   = &piece_parts_tbl[piece_stype];
-    s_field_shift_x = s_piece_parts->shift_x;
+    s_g->piece_stype   = piece_stype;
+    s_g->piece_parts   = &piece_parts_tbl[piece_stype];
+    s_g->field_shift_x = s_g->piece_parts->shift_x;
 }
 #endif  // USE_SELECT_PIECE
 
-// 変数.
-static pos_t    s_draw_field_x;
-static pos_t    s_draw_field_y;
+/// 現在のゲームの状態を始める. ピースのスタイルは s_game から引き継ぐ.
+///
+static void game_init(void) {
+    s_g->cur_state  = GAME_TITLE;
+    s_g->next_state = GAME_TITLE;
+    s_g->prev_state = GAME_EXIT;
+ #if defined(USE_SELECT_PIECE)
+    s_g->piece_stype = s_game.piece_stype;
+    select_piece_init(-1);
+ #endif
+}
+
+#define INFO_W          22          ///< 情報表示欄の横幅.
+#if !defined(MOTO_GAME)
+#define HELP_LINES      4           ///< ヘルプの行数.
+#else
+#define HELP_LINES      3
+#endif
 
 
 //  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
@@ -700,19 +576,77 @@ static pos_t    s_draw_field_y;
 static void     draw_gameTitle(void);
 static void     draw_gameStart(void);
 static void     draw_gamePlay(void);
+static void     draw_board(Player const* p, uint8_t no, uint8_t flags);
 static void     draw_gameOver(void);
 
+/// 固定表示物(壁・情報項目・ヘルプ)を1盤面分だけレイヤーに描く. 左の壁が原点.
+/// 盤面ごとに draw_board で重ねる. 描いていないセルは透明(CONS_CELL_NONE).
+static void draw_initLayer(void) {
+    cons_surface_t* l      = &s_g->layer;
+    bool            single = (s_board_num == 1);
+    pos_t           help_y = (s_field_h > 12 + HELP_LINES) ? s_field_h - HELP_LINES : 12;
+    pos_t           h      = single ? help_y + HELP_LINES : 6;
+    pos_t           x, y;
+
+    if (h < s_field_h)
+        h = s_field_h;
+    cons_surfaceTerm(l);
+    if (!cons_surfaceInit(l, FIELD_SCALE_X(s_field_w + 2) + INFO_W, h))
+        return;
+
+    // 壁.
+    for (y = 0; y < s_field_h; ++y) {
+        cons_surfacePutGlyph(l, 0,                           y, COL_WALL, s_g->gly[GLY_WALL]);
+        cons_surfacePutGlyph(l, FIELD_SCALE_X(s_field_w + 1), y, COL_WALL, s_g->gly[GLY_WALL]);
+    }
+    // 情報項目.
+    x = FIELD_SCALE_X(s_field_w + 2) + 1;
+    cons_surfacePuts(l, x, 0, COL_DEFAULT, "Level");
+    cons_surfacePuts(l, x, 1, COL_DEFAULT, "Lines");
+    cons_surfacePuts(l, x, 2, COL_DEFAULT, "Score");
+    cons_surfacePuts(l, x, 3, COL_DEFAULT, "Hi-SC");
+    cons_surfacePuts(l, x, 5, COL_DEFAULT, " Next");
+
+    // ヘルプ.
+    if (single) {
+        y = help_y;
+        cons_surfacePuts(l, x, y+0, COL_HELP, "Move  : CURSOR KEY");
+        cons_surfacePuts(l, x, y+1, COL_HELP, "Rotate: SPACE  KEY");
+        cons_surfacePuts(l, x, y+HELP_LINES-1, COL_HELP, "Quit  : ESC    KEY");
+    }
+}
+
+/// 欠片の文字列をグリフとして登録する. スタイルが変わった時だけ登録し直す.
+/// 同じ文字列は同じ id になるので、スタイルを往復しても登録は増えない.
+static void draw_initGlyphs(void) {
+ #if defined(USE_SELECT_PIECE)
+    if (s_g->gly_parts == s_g->piece_parts)
+        return;
+    s_g->gly_parts = s_g->piece_parts;
+ #else
+    if (s_g->gly[GLY_WALL] != CONS_GLYPH_NONE)
+        return;
+ #endif
+    s_g->gly[GLY_SPC]     = cons_glyphRegister(STR_SPC);
+    s_g->gly[GLY_P_FIX]   = cons_glyphRegister(STR_P_FIX);
+    s_g->gly[GLY_P_FALL]  = cons_glyphRegister(STR_P_FALL);
+    s_g->gly[GLY_P_REACH] = cons_glyphRegister(STR_P_REACH);
+    s_g->gly[GLY_WALL]    = cons_glyphRegister(STR_WALL);
+    draw_initLayer();
+}
+
 /// 毎フレームの描画更新.
 ///
 static void draw_gameUpdate(void) {
-    if (s_prev_state != s_cur_state || s_draw_flags == DRAWF_ALL) {
+    if (s_g->prev_state != s_g->cur_state || s_g->draw_flags == DRAWF_ALL) {
         // cons:テキスト画面バッファ・クリア.
         cons_clear();
-        s_draw_flags = DRAWF_ALL;
+        s_g->draw_flags = DRAWF_ALL;
+        draw_initGlyphs();
     } else {
         cons_setRefreshRect(0, 0, 0, 0, 0);
     }
-    switch (s_cur_state) {
+    switch (s_g->cur_state) {
     case GAME_TITLE: draw_gameTitle(); break;
     case GAME_START: draw_gameStart(); break;
     case GAME_PLAY:  draw_gamePlay();  break;
@@ -733,9 +667,9 @@ static void draw_piece(pos_t x, pos_t y, uint8_t shape, uint8_t rot, bool bk) {
         pos_t y2 = y + (i >> 2);
         if (y2 >= 0) {
             if (ptn & (0x8000 >> i)) {
-                cons_xycputs(x2, y2, co, STR_P_FALL);
+                cons_putGlyph(x2, y2, co, s_g->gly[GLY_P_FALL]);
             } else if (bk) {
-                cons_xycputs(x2, y2, COL_DEFAULT, STR_SPC);
+                cons_putGlyph(x2, y2, COL_DEFAULT, s_g->gly[GLY_SPC]);
             }
         }
     }
@@ -756,11 +690,11 @@ static void draw_gameTitle(void) {
     cons_xycputs((w-11)>>1, y+14, co, "HIT ANY KEY");
  #if defined(USE_SELECT_PIECE)
     cons_xycputs((w-21)>>1, y+16, co, "([C]hange the pieces)");
-    if (s_step == 1)
+    if (s_g->step == 1)
         select_piece_init(-1);
  #endif
-    draw_piece((w-FIELD_SCALE_X(4))>>1,y+7,s_piece_cur.shape,s_piece_cur.r,1);
-    if (s_step > 1)
+    draw_piece((w-FIELD_SCALE_X(4))>>1,y+7,s_g->title_piece.shape,s_g->title_piece.r,1);
+    if (s_g->step > 1)
         cons_setRefreshRect(0, (w-24)>>1, y+2, 24, 16-2);   // 画面更新範囲.
 }
 
@@ -768,146 +702,163 @@ static void draw_gameTitle(void) {
 ///
 static void draw_gameStart(void) {
     draw_gamePlay();
-    if (s_step > 1) {
-        pos_t x = s_draw_field_x + ((FIELD_SCALE_X(FIELD_W) - 10)>>1);
-        pos_t y = (cons_screenHeight() - 1) >> 1;
-        cons_xycputs(x, y, COL_START, "S T A R T!");
+    if (s_g->step > 1) {
+        pos_t   y = (cons_screenHeight() - 1) >> 1;
+        uint8_t i;
+        for (i = 0; i < s_board_num; ++i) {
+            Player const* p = &s_g->players[i];
+            pos_t x = p->draw_x + ((FIELD_SCALE_X(p->board.field.w) - 10)>>1);
+            cons_xycputs(x, y, COL_START, "S T A R T!");
+        }
     }
 }
 
-/// ゲームプレイ画面表示.
-///
-static void draw_gamePlay(void) {
-    uint8_t x, y;
-    pos_t   ofs_x = (cons_screenWidth()  - FIELD_SCALE_X(FIELD_W)) >> 1;
-    pos_t   ofs_y = (cons_screenHeight() - FIELD_H) >> 1;
+/// 盤面の表示位置を決める.
+/// 盤面が複数の時は [壁 フィールド 壁 情報欄] を横に並べる.
+static void draw_layout(void) {
+    int     fw    = FIELD_SCALE_X(s_field_w);
+    int     ofs_x = (cons_screenWidth()  - fw) >> 1;
+    int     ofs_y = (cons_screenHeight() - s_field_h) >> 1;
+    uint8_t i;
+    if (s_board_num > 1) {
+        int slot_w = FIELD_SCALE_X(2) + fw + INFO_W;
+        ofs_x  = (cons_screenWidth() - slot_w * s_board_num) >> 1;
+        ofs_x += FIELD_SCALE_X(1);
+    }
  #if (CONSINIT_FLAGS & 1) == 1  // スクリーン横幅40文字の時.
     ofs_x -= 10;
  #endif
-
     if (ofs_x < 0) ofs_x = 0;
     if (ofs_y < 0) ofs_y = 0;
+    for (i = 0; i < s_board_num; ++i) {
+        s_g->players[i].draw_x = (pos_t)ofs_x;
+        s_g->players[i].draw_y = (pos_t)ofs_y;
+        ofs_x += FIELD_SCALE_X(2) + fw + INFO_W;
+    }
+}
+
+/// ゲームプレイ画面表示.
+///
+static void draw_gamePlay(void) {
+    uint8_t i;
+    draw_layout();
+    for (i = 0; i < s_board_num; ++i) {
+        Player const* p = &s_g->players[i];
+        draw_board(p, i, s_g->draw_flags | p->draw_flags);
+    }
+}
 
-    s_draw_field_x = ofs_x;
-    s_draw_field_y = ofs_y;
+/// 盤面1つ分の表示.
+/// 盤面が1つの時は表示物ごとに、複数の時は盤面ごとに更新範囲を設定.
+static void draw_board(Player const* p, uint8_t no, uint8_t flags) {
+    Board const* b     = &p->board;
+    Field const* f     = &b->field;
+    pos_t        ofs_x = p->draw_x;
+    pos_t        ofs_y = p->draw_y;
+    pos_t        help_y;
+    pos_t        x, y;
+    bool         single = (s_board_num == 1);
+
+    (void)no;   // cons_setRefreshRect が空の環境用.
+    help_y = ofs_y + ((f->h > 12 + HELP_LINES) ? f->h - HELP_LINES : 12);
 
     // フィールド表示.
-    if (s_draw_flags & DRAWF_FIELD) {
-        pos_t dh = FIELD_H;
+    if (flags & DRAWF_FIELD) {
+        pos_t dh = f->h;
         if (ofs_y > 0) {    // フィールド1つ上のクリア.
             cons_xycprintf(ofs_x, ofs_y-1, COL_DEFAULT
-                    , "%*c", FIELD_SCALE_X(FIELD_W), ' ');
+                    , "%*c", FIELD_SCALE_X(f->w), ' ');
             ++dh;
         }
-        for (y = 0; y < FIELD_H; ++y) {
-            pos_t y2 = ofs_y + y;
-            for (x = 0; x < FIELD_W; ++x) {
+        for (y = 0; y < f->h; ++y) {
+            pos_t          y2   = ofs_y + y;
+            field_t const* line = field_line(f, y);
+            for (x = 0; x < f->w; ++x) {
                 pos_t   x2  = ofs_x + FIELD_SCALE_X(x);
-                field_t fld = field_get(x,y);
+                field_t fld = line[x];
                 if (fld) {
                     uint8_t shape = (fld & 7) - 1;
                     uint8_t co    = PIECE_SHAPE_TO_COLOR(shape);
                  #if !defined(MOTO_GAME)
                     if ((fld & 8) && (cons_tick() & 0x18))
-                        cons_xycputs(x2, y2, co + ATR_P_REACH, STR_P_REACH);
+                        cons_putGlyph(x2, y2, co + ATR_P_REACH, s_g->gly[GLY_P_REACH]);
                     else
-                        cons_xycputs(x2, y2, co + ATR_P_FIX, STR_P_FIX);
+                        cons_putGlyph(x2, y2, co + ATR_P_FIX, s_g->gly[GLY_P_FIX]);
                  #else
-                    cons_xycputs(x2, y2, co + ATR_P_FALL, STR_P_FALL);
+                    cons_putGlyph(x2, y2, co + ATR_P_FALL, s_g->gly[GLY_P_FALL]);
                  #endif
                 } else {
-                    cons_xycputs(x2, y2, COL_DEFAULT, STR_SPC);
+                    cons_putGlyph(x2, y2, COL_DEFAULT, s_g->gly[GLY_SPC]);
                 }
             }
         }
-        //cons_xyprintf(ofs_x,ofs_y-1,"%6lx n:%6lx",cons_clock(),s_fall_time);
 
         // 現在のピースを表示.
-        x = ofs_x + FIELD_SCALE_X(s_piece_cur.x);
-        y = ofs_y + s_piece_cur.y;
-        draw_piece(x, y, s_piece_cur.shape, s_piece_cur.r, 0);
-        if (s_draw_flags != DRAWF_ALL)
-            cons_setRefreshRect(0,ofs_x,ofs_y-1,FIELD_SCALE_X(FIELD_W),dh);
-    }
-
-    // 次のピースを表示.
-    if (s_draw_flags & DRAWF_NEXT) {
-        x = ofs_x + FIELD_SCALE_X(FIELD_W) + 4;
+        x = ofs_x + FIELD_SCALE_X(b->cur.x);
+        y = ofs_y + b->cur.y;
+        draw_piece(x, y, b->cur.shape, b->cur.r, 0);
+        if (single && flags != DRAWF_ALL)
+            cons_setRefreshRect(0,ofs_x,ofs_y-1,FIELD_SCALE_X(f->w),dh);
+    }
+
+    // 次のピースを表示. 0°の形状は3行に収まるので3行間隔で並べる.
+    if (flags & DRAWF_NEXT) {
+        uint8_t i, n = s_preview_num;
+        pos_t   max_n = ((single ? help_y : ofs_y + f->h) - (ofs_y + 7) - 1) / 3;
+        if (n > max_n)
+            n = (max_n > 0) ? max_n : 1;
+        x = ofs_x + FIELD_SCALE_X(f->w) + 4;
         y = ofs_y + 7;
-        draw_piece(x, y, s_piece_next.shape, s_piece_next.r, 1);
-
-        cons_setRefreshRect(1,x,y,FIELD_SCALE_X(4),4);
+        for (i = 0; i < n; ++i)
+            draw_piece(x, y + 3*i, prand_peek(&b->rand, i), 0, 1);
+        if (single)
+            cons_setRefreshRect(1,x,y,FIELD_SCALE_X(4),3*n+1);
     }
 
     // 情報表示.
-    if (s_draw_flags & DRAWF_INFO) {
+    if (flags & DRAWF_INFO) {
         cons_setcolor(COL_DEFAULT);
-        x  = ofs_x + FIELD_SCALE_X(FIELD_W) + 9;
+        x  = ofs_x + FIELD_SCALE_X(f->w) + 9;
         y  = ofs_y;
-        cons_xyprintf(x, y+0, "%u", s_level);
-        cons_xyprintf(x, y+1, "%u", s_lines);
+        cons_xyprintf(x, y+0, "%u", b->level);
+        cons_xyprintf(x, y+1, "%u", b->lines);
       #if !defined(MOTO_GAME)
-        if (s_pre_lines > s_lines) {
+        if (b->pre_lines > b->lines) {
             cons_setcolor(COL_HELP);
-            cons_printf(" (+%u)", s_pre_lines - s_lines);
+            cons_printf(" (+%u)", b->pre_lines - b->lines);
             cons_setcolor(COL_DEFAULT);
         } else {
             cons_puts("          ");
         }
       #endif
-        cons_xyprintf(x, y+2, "%u%s", s_score, s_score ? "00" : "");
+        cons_xyprintf(x, y+2, "%u%s", b->score, b->score ? "00" : "");
         cons_xyprintf(x, y+3, "%u%s", s_high_score, s_high_score ? "00" : "");
-
-        cons_setRefreshRect(2,x,y,14,4);
+        if (single)
+            cons_setRefreshRect(2,x,y,14,4);
     }
 
     // ヘルプ: ENTER KEY.
   #if !defined(MOTO_GAME)
-    if ((s_draw_flags & DRAWF_FIELD)) {
+    if (single && (flags & DRAWF_FIELD)) {
         uint8_t co = COL_HELP;
-        if (s_pre_lines > s_lines && (cons_tick() & 0x18))
+        if (b->pre_lines > b->lines && (cons_tick() & 0x18))
             co = COL_L_HELP;
-        x  = ofs_x + FIELD_SCALE_X(FIELD_W+1) + 1;
-        y  = ofs_y + 16;
-        cons_xycputs(x,y+2,co,"Clear : ENTER  KEY");
-        cons_setRefreshRect(3,x,y+2,20,1);
+        x  = ofs_x + FIELD_SCALE_X(f->w+1) + 1;
+        cons_xycputs(x,help_y+2,co,"Clear : ENTER  KEY");
+        cons_setRefreshRect(3,x,help_y+2,20,1);
     }
   #endif
 
     // 固定表示物.
-    if (s_draw_flags & DRAWF_TEXT) {
-        char const* wall = STR_WALL;
-        // 壁表示.
-        cons_setcolor(COL_WALL);
-        for (y = 0; y < FIELD_H; ++y) {
-            cons_xyputs(ofs_x-FIELD_SCALE_X(1),       ofs_y+y, wall);
-            cons_xyputs(ofs_x+FIELD_SCALE_X(FIELD_W), ofs_y+y, wall);
-        }
-        // 情報項目.
-        cons_setcolor(COL_DEFAULT);
-        x  = ofs_x + FIELD_SCALE_X(FIELD_W+1) + 1;
-        y  = ofs_y;
-        cons_xyputs(x, y+0, "Level");
-        cons_xyputs(x, y+1, "Lines");
-        cons_xyputs(x, y+2, "Score");
-        cons_xyputs(x, y+3, "Hi-SC");
-        cons_xyputs(x, y+5, " Next");
-
-        // ヘルプ.
-        cons_setcolor(COL_HELP);
-        x  = ofs_x + FIELD_SCALE_X(FIELD_W+1) + 1;
-      #if !defined(MOTO_GAME)
-        y  = ofs_y + 16;
-        cons_xyputs(x, y+0, "Move  : CURSOR KEY");
-        cons_xyputs(x, y+1, "Rotate: SPACE  KEY");
-        cons_xyputs(x, y+3, "Quit  : ESC    KEY");
-      #else
-        y  = ofs_y + 17;
-        cons_xyputs(x, y+0, "Move  : CURSOR KEY");
-        cons_xyputs(x, y+1, "Rotate: SPACE  KEY");
-        cons_xyputs(x, y+2, "Quit  : ESC    KEY");
-      #endif
+    if (flags & DRAWF_TEXT)
+        cons_blit(NULL, ofs_x - FIELD_SCALE_X(1), ofs_y, &s_g->layer, NULL);
 
+    // 盤面が複数の時は盤面ごとに1つの更新範囲.
+    if (!single && (flags & (DRAWF_FIELD|DRAWF_NEXT|DRAWF_INFO))
+        && flags != DRAWF_ALL)
+    {
+        cons_setRefreshRect(no, ofs_x - FIELD_SCALE_X(1), ofs_y - 1
+                , FIELD_SCALE_X(f->w + 2) + INFO_W, f->h + 1);
     }
 }
 
@@ -921,14 +872,15 @@ static void draw_gameOver(void) {
     pos_t   x    = (sc_w - w) >> 1;
     pos_t   y    = (sc_h - h) >> 1;
 
-    if (s_draw_flags & DRAWF_OVER) {    // 実質初回のみ描画.
+    if (s_g->draw_flags & DRAWF_OVER) {    // 実質初回のみ描画.
         char    buf[128];
         pos_t   l;
+        uint_t  score = bestScore();
         draw_gamePlay();
         for (l = 0; l < h; ++l) // 矩形でなく帯で描画.
             cons_xycprintf(0, y + l, COL_DEFAULT, "%*c", sc_w-1, ' ');
         cons_xycputs(x+((w-16)>>1), y+2, COL_GAMEOVER , "G A M E  O V E R");
-        snprintf(buf, sizeof(buf), "Score: %u%s", s_score, s_score ? "00":"");
+        snprintf(buf, sizeof(buf), "Score: %u%s", score, score ? "00":"");
         cons_xycputs(x+((w-strlen(buf))>>1), y+5, COL_L_SUB , buf);
         //cons_setRefreshRect(3,x,y,w,h);
     } else {
@@ -942,11 +894,11 @@ static void draw_gameOver(void) {
         static uint8_t const col[2] = { COL_INP, COL_L_INP, };
         uint8_t n;
         y += 7;
-        n = (s_choise == 0);
+        n = (s_g->choise == 0);
         cons_xycputs(x      , y, col[n], sels[n][0]);
-        n = (s_choise == 1);
+        n = (s_g->choise == 1);
         cons_xycputs(x +   7, y, col[n], sels[n][1]);
-        n = (s_choise == 2);
+        n = (s_g->choise == 2);
         cons_xycputs(x + 2*7, y, col[n], sels[n][2]);
     }
 }
@@ -954,6 +906,13 @@ static void draw_gameOver(void) {
 
 // -    -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
 
+/// 範囲内に収めた数値オプション.
+///
+static int optNum(char const* a, int mi, int ma) {
+    int n = atoi(a);
+    return (n < mi) ? mi : (n > ma) ? ma : n;
+}
+
 /// オプション取得.
 ///
 static void getOpt(char const* a) {
@@ -963,10 +922,34 @@ static void getOpt(char const* a) {
      #endif
     } else if (strncmp(a, "-hs", 3) == 0) {
         s_high_score = atoi(a+3);
+    } else if (strncmp(a, "-fw", 3) == 0) {     // フィールド横幅.
+        s_field_w   = optNum(a+3, FIELD_MIN_W, FIELD_MAX_W);
+    } else if (strncmp(a, "-fh", 3) == 0) {     // フィールド縦幅.
+        s_field_h   = optNum(a+3, FIELD_MIN_H, FIELD_MAX_H);
+    } else if (strncmp(a, "-fn", 3) == 0) {     // 同時プレイする盤面数.
+        s_board_num = optNum(a+3, 1, BOARD_MAX);
+    } else if (strncmp(a, "-rand", 5) == 0) {   // ピースの選び方.
+        s_rand_policy = optNum(a+5, 0, PIECE_RAND_POLICY_NUM-1);
+    } else if (strncmp(a, "-seed", 5) == 0) {   // 乱数の種.
+        s_rand_seed   = strtoul(a+5, NULL, 0);
+    } else if (strncmp(a, "-preview", 8) == 0) {// 次のピースの表示数.
+        s_preview_num = optNum(a+8, 1, PIECE_QUEUE_MAX);
+    } else if (strncmp(a, "-scr", 4) == 0) {    // 画面モード. PC-AT: 2=43行 4=50行 8=60行 16=132桁 32=ページ切替. curses: 64=曖昧幅を全角.
+        s_scr_flags   = optNum(a+4, 0, 0x7e);
+ #if defined(CONS_SERVER)
+    } else if (strncmp(a, "-listen", 7) == 0) { // 待ち受けるアドレス.
+        char* s = strdup(a+7);
+        if (s) {
+            s[strcspn(s, "\r\n")] = '\0';
+            s_listen_addr = s;
+        }
+ #endif
     }
 }
 
 #define CFG_NAME    "otitame.cfg"
+#define REPLAY_NAME "otitame.rep"
+#define TRACE_NAME  "otitame.json"
 
 /// ファイルからオプション取得.
 ///
@@ -986,8 +969,14 @@ static void saveOpts(void) {
     FILE* fp = fopen(CFG_NAME, "wt");
     if (fp) {
         fprintf(fp, "-hs%d\n"   , s_high_score);
+        fprintf(fp, "-fw%d\n"   , s_field_w);
+        fprintf(fp, "-fh%d\n"   , s_field_h);
+        fprintf(fp, "-fn%d\n"   , s_board_num);
+        fprintf(fp, "-rand%d\n" , s_rand_policy);
+        fprintf(fp, "-preview%d\n", s_preview_num);
+        fprintf(fp, "-scr%d\n"  , s_scr_flags);
      #if defined(USE_SELECT_PIECE)
-        fprintf(fp, "-piece%d\n", s_piece_stype);
+        fprintf(fp, "-piece%d\n", s_g->piece_stype);
      #endif
         fclose(fp);
     }
@@ -997,10 +986,24 @@ static void saveOpts(void) {
 ///
 int main(int argc, char* argv[]) {
     int i;
-    loadOpts();
+    for (i = 1; i < argc; ++i) {
+        if (strncmp(argv[i], "-rec", 4) == 0) {         // 入力を記録.
+            s_replay_mode = CONS_REPLAY_RECORD;
+            s_replay_path = argv[i][4] ? argv[i]+4 : REPLAY_NAME;
+        } else if (strncmp(argv[i], "-play", 5) == 0) { // 記録した入力を再生.
+            s_replay_mode = CONS_REPLAY_PLAY;
+            s_replay_path = argv[i][5] ? argv[i]+5 : REPLAY_NAME;
+        } else if (strncmp(argv[i], "-trace", 6) == 0) { // フレームの時間経過を記録.
+            cons_traceOpen(argv[i][6] ? argv[i]+6 : TRACE_NAME, 0);
+        }
+    }
+    // 記録/再生時は同じ条件で再現できるよう cfg を使わず、引数のみ.
+    if (s_replay_mode == CONS_REPLAY_OFF)
+        loadOpts();
     for (i = 1; i < argc; ++i)
         getOpt(argv[i]);
     gameMain();
-    saveOpts();
+    if (s_replay_mode == CONS_REPLAY_OFF)
+        saveOpts();
     return 0;
 }
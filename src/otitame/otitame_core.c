@@ -0,0 +1,285 @@
+/**
+ *  @file   otitame_core.c
+ *  @brief  落ちゲーの盤面処理(画面・入力・時間に依存しない部分).
+ *  @author tenk* ( https://github.com/tenk-a )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ */
+
+#include "otitame_core.h"
+#include <string.h>
+
+static void checkLevelUp(Board* b);
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  PIECE
+
+/// ピース形状 （7種類 × 4回転） src/tool/gen_shape.cpp
+uint16_t const piece_shapes[PIECE_SHAPE_NUM][4] = {
+    //  0       90     180     270
+    { 0x0660, 0x0660, 0x0660, 0x0660, },    // ■ O
+    { 0x0c60, 0x2640, 0x0c60, 0x2640, },    // z  Z
+    { 0x06c0, 0x4620, 0x06c0, 0x4620, },    // s  S
+    { 0x8e00, 0x6440, 0x0e20, 0x44c0, },    // ┛ J
+    { 0x2e00, 0x4460, 0x0e80, 0xc440, },    // ┗ L
+    { 0x04e0, 0x4640, 0x0e40, 0x4c40, },    // ┻ T
+    { 0x0f00, 0x2222, 0x0f00, 0x4444, },    // ┃ I
+};
+
+/// ピース形状1行(4bit)を、bit0 が左端になるよう反転する表.
+static uint8_t const piece_rowBits[16] = {
+    0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE,
+    0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF,
+};
+
+/// ピース初期化.
+///
+void piece_init(Piece* p, pos_t field_w, uint8_t shape) {
+    p->x     = (field_w / 2) - 2;
+    p->y     = -1;              // 各ピース 0°は上1行空白なので詰める.
+    p->r     = 0;
+    p->shape = shape;
+}
+
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  FIELD
+
+/// フィールド・クリア.
+///
+void field_clear(Field* f, pos_t w, pos_t h) {
+    uint8_t y;
+    f->w    = w;
+    f->h    = h;
+    f->full = (w >= FIELD_MAX_W) ? ~(fieldrow_t)0 : ((fieldrow_t)1 << w) - 1;
+    for (y = 0; y < FIELD_MAX_H; ++y)
+        f->row[y] = y;
+    memset(f->mask, 0, sizeof(f->mask));
+    memset(f->cell, 0, sizeof(f->cell));
+}
+
+/// ピースを置けるか?
+///
+bool field_canPlacePiece(Field const* f, Piece const* p) {
+    uint16_t ptn = piece_shapes[p->shape][p->r];
+    pos_t    x0  = p->x, y = p->y;
+    uint8_t  i;
+    for (i = 0; i < 4; ++i, ++y, ptn <<= 4) {
+        fieldrow_t bits = piece_rowBits[ptn >> 12];
+        if (y < 0 || !bits)
+            continue;
+        if (x0 < 0) {
+            if (bits & ((1U << -x0) - 1))   // 左にはみ出し.
+                return 0;
+            bits >>= -x0;
+        } else if (x0 >= f->w || (f->w - x0 < 4 && (bits >> (f->w - x0)))) {
+            return 0;                       // 右にはみ出し.
+        } else {
+            bits <<= x0;
+        }
+        if (y >= f->h || (bits & field_mask(f, y)))
+            return 0;
+    }
+    return 1;
+}
+
+/// ピースの固定.
+///
+void field_placePiece(Field* f, Piece const* p) {
+    uint16_t ptn = piece_shapes[p->shape][p->r];
+    pos_t    x0  = p->x, y0 = p->y;
+    uint8_t  i;
+    for (i = 0; i < 16; ++i) {
+        if (ptn & (0x8000 >> i)) {
+            pos_t x = x0 + (i &  3);
+            pos_t y = y0 + (i >> 2);
+            if (y >= 0 && y < f->h && x >= 0 && x < f->w) {
+                field_line(f, y)[x] = p->shape + 1;
+                field_mask(f, y)   |= (fieldrow_t)1 << x;
+            }
+        }
+    }
+}
+
+/// 格納行 r を空にして row[0..n-1] に置く.
+///
+static void field_recycleRows(Field* f, uint8_t const* rows, uint8_t n) {
+    uint8_t i;
+    for (i = 0; i < n; ++i) {
+        uint8_t r  = rows[i];
+        f->row[i]  = r;
+        f->mask[r] = 0;
+        memset(f->cell[r], 0, f->w * sizeof(field_t));
+    }
+}
+
+#if !defined(MOTO_GAME)
+
+/// 行が揃ったか?
+/// @return 今回揃ったライン数.
+uint8_t filed_checkReach(Field* f) {
+    uint8_t lines = 0;
+    pos_t   x,  y = f->h;
+    while (--y >= 0) {
+        field_t* line = field_line(f, y);
+        if (field_mask(f, y) == f->full && !(line[0] & 0x8)) {
+            for (x = 0; x < f->w; ++x)
+                line[x] |= 8;
+            ++lines;
+        }
+    }
+    return lines;
+}
+
+/// ライン消去.
+/// 一番下の揃った行から連なっている行を纏めて消す.
+/// 上の行は row[] をずらすだけで詰める.
+/// @return 消去したライン数.
+uint8_t filed_clearLines(Field* f) {
+    uint8_t rows[FIELD_MAX_H];
+    uint8_t lines;
+    pos_t   top, y = f->h;
+    while (--y >= 0 && !(field_get(f, 0, y) & 0x8))    // 一番下の揃った行.
+        ;
+    if (y < 0)
+        return 0;
+    top = y;
+    while (--top >= 0 && (field_get(f, 0, top) & 0x8)) // 連なった行の上端.
+        ;
+    ++top;                      // top..y が消去範囲.
+    lines = y + 1 - top;
+    memcpy(rows, &f->row[top], lines);
+    memmove(&f->row[lines], &f->row[0], top);
+    field_recycleRows(f, rows, lines);
+    return lines;
+}
+
+#else   // MOTO_GAME
+
+/// 元ゲー:ライン消去.
+/// 下から走査し、残す行の row[] を一度だけ書込み位置へ移す.
+/// @return 消去したライン数.
+uint8_t filed_clearLinesMoto(Field* f) {
+    uint8_t rows[FIELD_MAX_H];
+    uint8_t lines = 0;
+    pos_t   y = f->h, dst = f->h;
+    while (--y >= 0) {
+        uint8_t r = f->row[y];
+        if (f->mask[r] == f->full)
+            rows[lines++] = r;  // 揃った行の格納場所は上に回す.
+        else
+            f->row[--dst] = r;
+    }
+    field_recycleRows(f, rows, lines);
+    return lines;
+}
+#endif
+
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  SCORE
+
+/// スコア加算.
+///
+static void addScore(Board* b, uint_t score) {
+    b->score += score;
+}
+
+#if !defined(MOTO_GAME)
+
+/// 着地処理.
+///
+static void pieceLand(Board* b) {
+    uint8_t reached = filed_checkReach(&b->field);
+    if (reached > 0) {
+        b->pre_lines += reached;
+        addScore(b, reached * reached);
+    }
+}
+
+/// ピース・クリア. タメてた行を消す.
+///
+void board_clear(Board* b) {
+    uint8_t cleared = filed_clearLines(&b->field);
+    if (cleared > 0) {
+        b->lines += cleared;
+        addScore(b, (uint_t)cleared * (cleared + 1) / 2);   // 1+2+..+n
+        checkLevelUp(b);        // レベルアップ.
+    }
+}
+
+#else // defined(MOTO_GAME)
+
+/// 元ゲー:着地処理.
+///
+static void pieceLandMoto(Board* b) {
+    uint8_t cleared = filed_clearLinesMoto(&b->field);
+    if (cleared > 0) {
+        b->lines += cleared;
+        addScore(b, cleared*cleared);
+        checkLevelUp(b);        // レベルアップ.
+    }
+}
+
+#endif
+
+/// レベルアップ・チェック.
+///
+static void checkLevelUp(Board* b) {
+    uint_t  new_level = b->lines / 10 + 1;
+    if (b->level < new_level) {
+        b->level  = new_level;
+        b->speed  = (b->speed > 2*GAME_MIN_SPEED)
+                  ? (b->speed - GAME_MIN_SPEED)
+                  : GAME_MIN_SPEED;
+    }
+}
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  BOARD
+
+/// 盤面初期化. 最初のピースも出しておく.
+///
+void board_init(Board* b, pos_t w, pos_t h, uint8_t policy, uint32_t seed) {
+    field_clear(&b->field, w, h);
+    prand_init(&b->rand, policy, seed);
+    piece_init(&b->cur, w, prand_next(&b->rand));
+    b->lines     = 0;
+    b->pre_lines = 0;
+    b->level     = 1;
+    b->speed     = 10*GAME_MIN_SPEED;
+    b->score     = 0;
+    b->over      = 0;
+}
+
+/// ピースの移動・回転. 置けなければ動かさない.
+/// @return 動いたら 1.
+bool board_move(Board* b, pos_t dx, pos_t dy, uint8_t dr) {
+    Piece cur = b->cur;
+    cur.x += dx;
+    cur.y += dy;
+    cur.r  = (cur.r + dr) & 3;
+    if (!field_canPlacePiece(&b->field, &cur))
+        return 0;
+    b->cur = cur;
+    return 1;
+}
+
+/// 1段落下. 落ちられなければ着地して次のピースを出す.
+/// @return BOARD_FALL:落下 BOARD_LAND:着地 BOARD_OVER:出現場所で衝突.
+uint8_t board_fall(Board* b) {
+    if (board_move(b, 0, 1, 0))
+        return BOARD_FALL;
+    field_placePiece(&b->field, &b->cur);
+ #if !defined(MOTO_GAME)
+    pieceLand(b);
+ #else
+    pieceLandMoto(b);
+ #endif
+    piece_init(&b->cur, b->field.w, prand_next(&b->rand)); // 次のピース.
+    if (!field_canPlacePiece(&b->field, &b->cur)) {
+        b->over = 1;
+        return BOARD_OVER;
+    }
+    return BOARD_LAND;
+}
@@ -0,0 +1,117 @@
+/**
+ *  @file   otitame_core.h
+ *  @brief  落ちゲーの盤面処理(画面・入力・時間に依存しない部分).
+ *  @author tenk* ( https://github.com/tenk-a )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   cons を使わないので、シミュレータ otitame_sim からも使う.
+ */
+#ifndef OTITAME_CORE_H__
+#define OTITAME_CORE_H__
+
+#include "otitame_rand.h"
+#if __STDC_VERSION__ >= 199901L || __cplusplus >= 201103L
+ #include <stdint.h>
+ #if !defined(__cplusplus)
+  #include <stdbool.h>
+ #endif
+#else
+typedef unsigned short  uint16_t;
+typedef unsigned char   bool;
+#endif
+
+//#define MOTO_GAME
+
+typedef unsigned int    uint_t;
+typedef short           pos_t;
+
+#if defined(UINT64_MAX)
+typedef uint64_t        fieldrow_t;     ///< フィールド1行分の占有ビット.
+#else
+typedef unsigned long   fieldrow_t;
+#endif
+
+#define FIELD_W         10              ///< フィールド横幅(デフォルト).
+#define FIELD_H         20              ///< フィールド縦幅(デフォルト).
+#define FIELD_MIN_W     4               ///< フィールド最小横幅.
+#define FIELD_MIN_H     8               ///< フィールド最小縦幅.
+#define FIELD_MAX_W     ((pos_t)(sizeof(fieldrow_t) * 8))   ///< 最大横幅.
+#define FIELD_MAX_H     64              ///< フィールド最大縦幅.
+
+#define GAME_MIN_SPEED  50              ///< 最小落下間隔(ミリ秒).
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  PIECE
+
+#define PIECE_SHAPE_NUM   7     ///< ピース形状の種類数.
+
+typedef struct Piece {
+    pos_t       x;              ///< Field 内x位置.
+    pos_t       y;              ///< Field 内y位置.
+    uint8_t     shape;          ///< 形状 shape 種類(0〜6)
+    uint8_t     r;              ///< 回転 rotate (0:0,1:90,2:180,3:270)
+} Piece;
+
+extern uint16_t const piece_shapes[PIECE_SHAPE_NUM][4];
+
+void    piece_init(Piece* p, pos_t field_w, uint8_t shape);
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  FIELD
+
+typedef uint8_t         field_t;
+
+/// フィールド.
+/// 表示行→格納行 の変換表 row[] を介して参照するので、
+/// ライン消去は row[] の並べ替えだけで済み、セルのコピーは発生しない.
+typedef struct Field {
+    pos_t       w;                              ///< 横幅.
+    pos_t       h;                              ///< 縦幅.
+    fieldrow_t  full;                           ///< 1行揃った時の占有ビット.
+    uint8_t     row[FIELD_MAX_H];               ///< 表示行→格納行.
+    fieldrow_t  mask[FIELD_MAX_H];              ///< 格納行の占有ビット(bit x が x列).
+    field_t     cell[FIELD_MAX_H][FIELD_MAX_W]; ///< 格納行のセル.
+} Field;
+
+#define field_line(f,y)     ((f)->cell[(f)->row[y]])
+#define field_mask(f,y)     ((f)->mask[(f)->row[y]])
+#define field_get(f,x,y)    (field_line(f,y)[x])
+
+void    field_clear(Field* f, pos_t w, pos_t h);
+bool    field_canPlacePiece(Field const* f, Piece const* p);
+void    field_placePiece(Field* f, Piece const* p);
+#if !defined(MOTO_GAME)
+uint8_t filed_checkReach(Field* f);
+uint8_t filed_clearLines(Field* f);
+#else
+uint8_t filed_clearLinesMoto(Field* f);
+#endif
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  BOARD
+
+/// 盤面. フィールド1つ分のプレイ状態.
+typedef struct Board {
+    Field       field;          ///< フィールド.
+    Piece       cur;            ///< 現在のピース.
+    PieceRand   rand;           ///< ピース乱数. 次以降のピースはこのキュー.
+    uint_t      lines;          ///< クリアしたライン数.
+    uint_t      pre_lines;      ///< 揃ったライン数.
+    uint_t      level;          ///< レベル.
+    uint_t      score;          ///< スコア.
+    uint_t      speed;          ///< 落下間隔(ミリ秒).
+    bool        over;           ///< 出現場所で衝突した.
+} Board;
+
+/// board_fall の結果.
+enum { BOARD_OVER = 0, BOARD_FALL = 1, BOARD_LAND = 2 };
+
+void    board_init(Board* b, pos_t w, pos_t h, uint8_t policy, uint32_t seed);
+bool    board_move(Board* b, pos_t dx, pos_t dy, uint8_t dr);
+uint8_t board_fall(Board* b);
+#if !defined(MOTO_GAME)
+void    board_clear(Board* b);
+#endif
+
+#endif  // OTITAME_CORE_H__
@@ -0,0 +1,93 @@
+/**
+ *  @file   otitame_rand.c
+ *  @brief  落ちゲーのピース乱数とプレビュー・キュー.
+ *  @author tenk* ( https://github.com/tenk-a )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ */
+
+#include "otitame_rand.h"
+#include <string.h>
+
+#define PIECE_HISTORY_TRIES 4       ///< history 方式の引き直し回数.
+
+/// xorshift32.
+///
+uint32_t prand_u32(uint32_t* seed) {
+    uint32_t x = *seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *seed = x;
+    return x;
+}
+
+/// 種 seed から、stream 番目の独立した種を作る.
+/// 盤面ごと、スレッドごとに別の並びにするため.
+uint32_t prand_seed(uint32_t seed, unsigned stream) {
+    uint32_t z = seed + (uint32_t)stream * 0x9E3779B9UL;
+    z = (z ^ (z >> 16)) * 0x85EBCA6BUL;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35UL;
+    z ^= z >> 16;
+    return z ? z : 0x2545F491UL;    // xorshift は 0 だと止まる.
+}
+
+/// 0..n-1 の乱数.
+///
+static uint8_t prand_n(PieceRand* r, uint8_t n) {
+    return (uint8_t)(((prand_u32(&r->seed) >> 16) * n) >> 16);
+}
+
+/// 方式に従って次の形状を1つ作る.
+///
+static uint8_t prand_gen(PieceRand* r) {
+    uint8_t s, i;
+    switch (r->policy) {
+    case PIECE_RAND_BAG:
+        if (r->bag_n == 0) {    // 袋が空なら7種を詰め直す.
+            for (i = 0; i < PIECE_RAND_SHAPE_NUM; ++i)
+                r->bag[i] = i;
+            r->bag_n = PIECE_RAND_SHAPE_NUM;
+        }
+        i = prand_n(r, r->bag_n);
+        s = r->bag[i];
+        r->bag[i] = r->bag[--r->bag_n];
+        return s;
+
+    case PIECE_RAND_HISTORY:
+        for (i = 0; i < PIECE_HISTORY_TRIES; ++i) {
+            s = prand_n(r, PIECE_RAND_SHAPE_NUM);
+            if (memchr(r->hist, s, PIECE_HISTORY_NUM) == NULL)
+                break;
+        }
+        memmove(&r->hist[1], &r->hist[0], PIECE_HISTORY_NUM - 1);
+        r->hist[0] = s;
+        return s;
+
+    default:    // PIECE_RAND_UNIFORM
+        return prand_n(r, PIECE_RAND_SHAPE_NUM);
+    }
+}
+
+/// 初期化. キューを満たしておく.
+///
+void prand_init(PieceRand* r, uint8_t policy, uint32_t seed) {
+    static uint8_t const hist[PIECE_HISTORY_NUM] = { 1, 2, 1, 2 }; // Z S Z S
+    uint8_t i;
+    r->seed   = seed ? seed : 0x2545F491UL;
+    r->policy = (policy < PIECE_RAND_POLICY_NUM) ? policy : PIECE_RAND_UNIFORM;
+    r->head   = 0;
+    r->bag_n  = 0;
+    memcpy(r->hist, hist, sizeof(r->hist));
+    for (i = 0; i < PIECE_QUEUE_MAX; ++i)
+        r->queue[i] = prand_gen(r);
+}
+
+/// キュー先頭の形状を取り出し、末尾に新しい形状を足す.
+///
+uint8_t prand_next(PieceRand* r) {
+    uint8_t s = r->queue[r->head];
+    r->queue[r->head] = prand_gen(r);
+    r->head = (r->head + 1) & (PIECE_QUEUE_MAX - 1);
+    return s;
+}
@@ -0,0 +1,51 @@
+/**
+ *  @file   otitame_rand.h
+ *  @brief  落ちゲーのピース乱数とプレビュー・キュー.
+ *  @author tenk* ( https://github.com/tenk-a )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   rand() を使わず盤面ごとに状態を持つので、種が同じなら同じ並びになる.
+ */
+#ifndef OTITAME_RAND_H__
+#define OTITAME_RAND_H__
+
+#if __STDC_VERSION__ >= 199901L || __cplusplus >= 201103L
+ #include <stdint.h>
+#else
+typedef unsigned char   uint8_t;
+typedef unsigned long   uint32_t;
+#endif
+
+#define PIECE_RAND_SHAPE_NUM    7   ///< ピース形状の種類数.
+#define PIECE_QUEUE_MAX         8   ///< プレビュー・キューの長さ(2の冪).
+#define PIECE_HISTORY_NUM       4   ///< history 方式で避ける直近の個数.
+
+/// ピースの選び方.
+typedef enum PieceRandPolicy {
+    PIECE_RAND_UNIFORM  = 0,        ///< 一様乱数.
+    PIECE_RAND_BAG      = 1,        ///< 7種を1袋にして順不同に出す(7-bag).
+    PIECE_RAND_HISTORY  = 2,        ///< 直近に出た形状を避けて引き直す.
+    PIECE_RAND_POLICY_NUM
+} PieceRandPolicy;
+
+/// ピース乱数.
+typedef struct PieceRand {
+    uint32_t    seed;                       ///< xorshift32 の状態.
+    uint8_t     policy;                     ///< PieceRandPolicy.
+    uint8_t     head;                       ///< キュー先頭.
+    uint8_t     bag_n;                      ///< 袋の残り数.
+    uint8_t     bag[PIECE_RAND_SHAPE_NUM];  ///< 袋.
+    uint8_t     hist[PIECE_HISTORY_NUM];    ///< 直近に出た形状.
+    uint8_t     queue[PIECE_QUEUE_MAX];     ///< プレビュー・キュー(リング).
+} PieceRand;
+
+uint32_t    prand_u32(uint32_t* seed);
+uint32_t    prand_seed(uint32_t seed, unsigned stream);
+void        prand_init(PieceRand* r, uint8_t policy, uint32_t seed);
+uint8_t     prand_next(PieceRand* r);
+
+/// i 番目(0が次)のプレビュー形状.
+#define prand_peek(r, i)    ((r)->queue[((r)->head + (i)) & (PIECE_QUEUE_MAX-1)])
+
+#endif  // OTITAME_RAND_H__
@@ -0,0 +1,597 @@
+/**
+ *  @file   otitame_sim.c
+ *  @brief  落ちゲーのスコア・バランス調整用シミュレータ.
+ *  @author tenk* ( https://github.com/tenk-a )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   otitame_core を画面なしで大量に遊ばせ、スコア等の分布と処理速度を出す.
+ *   ピースは出現位置で回転・横移動してから真下に落とす(途中の引っ掛かりは見ない).
+ *   ゲーム番号ごとに乱数の種を分けるので、スレッド数を変えても結果は同じ.
+ *
+ *   otitame_sim [-gN] [-jN] [-p{random|greedy|bot}] [-fwN] [-fhN] [-randN]
+ *               [-seedN] [-maxpN] [-bankN]
+ */
+
+#include "otitame_core.h"
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#if defined(_WIN32)
+ #include <windows.h>
+#else
+ #include <pthread.h>
+ #include <unistd.h>
+#endif
+
+#define SIM_THREAD_MAX  64          ///< 最大スレッド数.
+#define SIM_HIST_LOG_N  32          ///< log2 ヒストグラムの区間数.
+#define SIM_HIST_LEVEL  32          ///< レベル・ヒストグラムの区間数.
+
+typedef unsigned long long  ulonglong_t;
+
+/// 置き方の方針.
+typedef enum SimPolicy {
+    SIM_RANDOM = 0,                 ///< 置ける場所から適当に.
+    SIM_GREEDY = 1,                 ///< その場の着地点数が最大の所. 危なくなるまでタメる.
+    SIM_BOT    = 2,                 ///< 盤面評価(高さ・穴・凸凹)で選び、-bank 行タメたら消す.
+    SIM_POLICY_NUM
+} SimPolicy;
+
+static char const* const s_policy_names[SIM_POLICY_NUM] = { "random", "greedy", "bot" };
+
+static uint8_t      s_policy     = SIM_BOT;     ///< 置き方の方針.
+static ulonglong_t  s_games      = 100000;      ///< ゲーム数.
+static unsigned     s_threads    = 0;           ///< スレッド数. 0 ならコア数.
+static pos_t        s_field_w    = FIELD_W;     ///< フィールド横幅.
+static pos_t        s_field_h    = FIELD_H;     ///< フィールド縦幅.
+static uint8_t      s_rand_policy = PIECE_RAND_UNIFORM; ///< ピースの選び方.
+static uint32_t     s_seed       = 0;           ///< 乱数の種. 0 なら時間から.
+static unsigned long s_max_place = 1000;        ///< 1ゲームの最大ピース数.
+static uint8_t      s_bank       = 4;           ///< bot が消すまでにタメる行数.
+
+/// 集計.
+typedef struct SimStats {
+    ulonglong_t     games;                          ///< ゲーム数.
+    ulonglong_t     placements;                     ///< 置いたピース数.
+    ulonglong_t     clears;                         ///< クリア操作の回数.
+    ulonglong_t     capped;                         ///< 最大ピース数で打ち切ったゲーム数.
+    ulonglong_t     score;                          ///< スコア合計.
+    ulonglong_t     land_score;                     ///< 内、着地(揃えた)時の点.
+    ulonglong_t     clear_score;                    ///< 内、クリア時の点.
+    ulonglong_t     lines;                          ///< クリアしたライン数合計.
+    ulonglong_t     left_lines;                     ///< 終了時に残ったタメ行数合計.
+    ulonglong_t     score_max;                      ///< 最高スコア.
+    ulonglong_t     score_hist[SIM_HIST_LOG_N];     ///< スコア分布(log2).
+    ulonglong_t     lines_hist[SIM_HIST_LOG_N];     ///< ライン数分布(log2).
+    ulonglong_t     level_hist[SIM_HIST_LEVEL];     ///< 終了時レベル分布.
+    ulonglong_t     bank_hist[FIELD_MAX_H + 1];     ///< クリア時のタメ行数(pre_lines - lines)分布.
+} SimStats;
+
+/// スレッドごとの作業域.
+typedef struct SimThread {
+    unsigned        no;             ///< スレッド番号.
+    SimStats        stats;          ///< 集計.
+    Board           board;          ///< 盤面.
+} SimThread;
+
+static SimThread    s_work[SIM_THREAD_MAX];
+
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  評価.
+
+/// ビット数.
+///
+static uint8_t sim_popCount(fieldrow_t v) {
+    uint8_t n = 0;
+    while (v) {
+        v &= v - 1;
+        ++n;
+    }
+    return n;
+}
+
+/// log2 区間番号. 0 は 0、n は 2^(n-1)..2^n-1.
+///
+static uint8_t sim_log2Bin(ulonglong_t v) {
+    uint8_t n = 0;
+    while (v && n < SIM_HIST_LOG_N - 1) {
+        v >>= 1;
+        ++n;
+    }
+    return n;
+}
+
+/// 置き場所探索用の形状情報.
+typedef struct SimShape {
+    uint8_t     rows[4];        ///< 各行の占有ビット(bit0 が左端).
+    int8_t      top[4];         ///< 各列の一番上の行. 無ければ -1.
+    int8_t      bottom[4];      ///< 各列の一番下の行. 無ければ -1.
+    int8_t      left;           ///< 占有する左端の列.
+    int8_t      right;          ///< 占有する右端の列.
+    bool        same;           ///< それより前の回転と同じ形.
+} SimShape;
+
+static SimShape     s_shapes[PIECE_SHAPE_NUM][4];
+
+/// piece_shapes から s_shapes を作る.
+///
+static void sim_initShapes(void) {
+    uint8_t s, r, r2, i, c;
+    for (s = 0; s < PIECE_SHAPE_NUM; ++s) {
+        for (r = 0; r < 4; ++r) {
+            SimShape* sh  = &s_shapes[s][r];
+            uint16_t  ptn = piece_shapes[s][r];
+            memset(sh, 0, sizeof(*sh));
+            sh->left  = 4;
+            sh->right = -1;
+            for (c = 0; c < 4; ++c)
+                sh->top[c] = sh->bottom[c] = -1;
+            for (i = 0; i < 4; ++i) {
+                for (c = 0; c < 4; ++c) {
+                    if (ptn & (0x8000 >> (i * 4 + c))) {
+                        sh->rows[i]  |= 1 << c;
+                        sh->bottom[c] = i;
+                        if (sh->top[c] < 0)
+                            sh->top[c] = i;
+                        if (sh->left  > c) sh->left  = c;
+                        if (sh->right < c) sh->right = c;
+                    }
+                }
+            }
+            for (r2 = 0; r2 < r; ++r2) {
+                if (piece_shapes[s][r2] == ptn)
+                    sh->same = 1;
+            }
+        }
+    }
+}
+
+/// 置く前の盤面の情報. 置き場所ごとの評価はこれとの差分で求める.
+typedef struct SimBase {
+    fieldrow_t  mask[FIELD_MAX_H];  ///< 表示行順の占有ビット.
+    pos_t       tops[FIELD_MAX_W];  ///< 各列の一番上の埋まった行. 空なら h.
+    long        agg;                ///< 列の高さの合計.
+    long        holes;              ///< 穴(上が埋まった空き)の数.
+} SimBase;
+
+/// 盤面の情報を集める.
+///
+static void sim_base(SimBase* e, Field const* f) {
+    fieldrow_t seen = 0;
+    pos_t      x, y;
+    e->agg   = 0;
+    e->holes = 0;
+    for (x = 0; x < f->w; ++x)
+        e->tops[x] = f->h;
+    for (y = 0; y < f->h; ++y) {
+        fieldrow_t m   = e->mask[y] = field_mask(f, y);
+        fieldrow_t top = m & ~seen;
+        e->holes += sim_popCount(seen & ~m);
+        seen |= top;
+        for (x = 0; top; ++x, top >>= 1) {
+            if (top & 1) {
+                e->tops[x] = y;
+                e->agg    += f->h - y;
+            }
+        }
+    }
+}
+
+/// (x,y) に置いた時に揃う行数.
+///
+static uint8_t sim_reached(SimBase const* e, Field const* f, SimShape const* sh, pos_t x, pos_t y) {
+    uint8_t i, reached = 0;
+    for (i = 0; i < 4; ++i, ++y) {
+        fieldrow_t bits = sh->rows[i];
+        if (bits && y >= 0) {
+            bits = (x >= 0) ? bits << x : bits >> -x;
+            if ((e->mask[y] | bits) == f->full)
+                ++reached;
+        }
+    }
+    return reached;
+}
+
+/// (x,y) に置いた後の盤面評価(大きいほど良い).
+/// 係数は El-Tetris 系の4特徴量(揃う行, 高さ合計, 穴, 凸凹)を整数化したもの.
+/// ピースの各列のセルは縦に連続しているので、高さと穴はその列の差分だけで済む.
+static long sim_evalBot(SimBase const* e, Field const* f, SimShape const* sh, pos_t x, pos_t y) {
+    pos_t   tops[FIELD_MAX_W];
+    long    agg = e->agg, holes = e->holes, bump = 0;
+    uint8_t c;
+    pos_t   i;
+    memcpy(tops, e->tops, sizeof(tops[0]) * f->w);
+    for (c = sh->left; c <= sh->right; ++c) {
+        if (sh->bottom[c] >= 0 && y + sh->bottom[c] >= 0) { // 画面外の上は数えない.
+            pos_t t = (y + sh->top[c] > 0) ? y + sh->top[c] : 0;
+            holes += tops[x + c] - 1 - (y + sh->bottom[c]);
+            agg   += tops[x + c] - t;
+            tops[x + c] = t;
+        }
+    }
+    for (i = 1; i < f->w; ++i)
+        bump += (tops[i] > tops[i-1]) ? tops[i] - tops[i-1] : tops[i-1] - tops[i];
+    return 760L * sim_reached(e, f, sh, x, y) - 510L * agg - 357L * holes - 184L * bump;
+}
+
+/// 一番上の埋まっている行からの高さ.
+///
+static pos_t sim_stackHeight(Field const* f) {
+    pos_t y;
+    for (y = 0; y < f->h; ++y) {
+        if (field_mask(f, y))
+            return f->h - y;
+    }
+    return 0;
+}
+
+/// 方針に従って、現在のピースの置き場所を選ぶ.
+/// 各列の一番上の埋まった行から、真下に落とした着地位置を求める.
+/// @return 選べたら 1. b->cur を着地位置にする.
+static bool sim_choose(Board* b, uint32_t* rs) {
+    Field const* f = &b->field;
+    SimBase      e;
+    Piece        best = b->cur;
+    long         best_val = 0;
+    unsigned     n = 0;
+    uint8_t      r, c;
+    pos_t        x, y;
+    sim_base(&e, f);
+    for (r = 0; r < 4; ++r) {
+        SimShape const* sh = &s_shapes[b->cur.shape][r];
+        if (sh->same)
+            continue;       // 同じ形の回転は1度だけ.
+        for (x = -sh->left; x + sh->right < f->w; ++x) {
+            long val;
+            y = f->h;
+            for (c = sh->left; c <= sh->right; ++c) {
+                if (sh->bottom[c] >= 0 && y > e.tops[x + c] - 1 - sh->bottom[c])
+                    y = e.tops[x + c] - 1 - sh->bottom[c];
+            }
+            if (y < b->cur.y)
+                continue;   // 出現位置で既にぶつかる(穴の中に出た場合も諦める).
+            switch (s_policy) {
+            case SIM_RANDOM:    // 候補 n 個目を 1/n で採用.
+                val = 0;
+                if (prand_u32(rs) % (n + 1) == 0) {
+                    best.x = x;
+                    best.y = y;
+                    best.r = r;
+                }
+                ++n;
+                continue;
+            case SIM_GREEDY: {  // 揃う行数の2乗、次に低い所.
+                uint8_t reached = sim_reached(&e, f, sh, x, y);
+                val = (long)reached * reached * 1000 + y;
+                break; }
+            default:            // SIM_BOT
+                val = sim_evalBot(&e, f, sh, x, y);
+                break;
+            }
+            if (n == 0 || best_val < val) {
+                best_val = val;
+                best.x   = x;
+                best.y   = y;
+                best.r   = r;
+            }
+            ++n;
+        }
+    }
+    if (n == 0)
+        return 0;
+    b->cur = best;
+    return 1;
+}
+
+/// 方針に従って、タメた行を消すか?
+///
+static bool sim_wantClear(Board const* b, uint32_t* rs) {
+    uint_t bank = b->pre_lines - b->lines;
+    if (bank == 0)
+        return 0;
+    switch (s_policy) {
+    case SIM_RANDOM:
+        return (prand_u32(rs) & 3) == 0;
+    case SIM_GREEDY:
+        return sim_stackHeight(&b->field) > b->field.h / 2;
+    default:    // SIM_BOT
+        return bank >= s_bank || sim_stackHeight(&b->field) > b->field.h - 6;
+    }
+}
+
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  ゲーム.
+
+/// 1ゲーム分のシミュレーション.
+///
+static void sim_game(SimThread* t, ulonglong_t no) {
+    SimStats*     st = &t->stats;
+    Board*        b  = &t->board;
+    uint32_t      rs = prand_seed(s_seed, (unsigned)(no * 2 + 1));
+    unsigned long n;
+    uint_t        score;
+    board_init(b, s_field_w, s_field_h, s_rand_policy, prand_seed(s_seed, (unsigned)(no * 2)));
+    for (n = 0; n < s_max_place; ++n) {
+        uint8_t rc;
+        if (!sim_choose(b, &rs))
+            break;
+        score = b->score;
+        rc    = board_fall(b);      // 着地位置にいるので、ここで固定される.
+        st->land_score += b->score - score;
+        ++st->placements;
+        if (rc == BOARD_OVER)
+            break;
+     #if !defined(MOTO_GAME)
+        if (sim_wantClear(b, &rs)) {
+            uint_t bank = b->pre_lines - b->lines;
+            ++st->bank_hist[(bank > FIELD_MAX_H) ? FIELD_MAX_H : bank];
+            ++st->clears;
+            score = b->score;
+            board_clear(b);
+            st->clear_score += b->score - score;
+        }
+     #endif
+    }
+    if (n >= s_max_place)
+        ++st->capped;
+    ++st->games;
+    st->score      += b->score;
+    st->lines      += b->lines;
+    st->left_lines += b->pre_lines - b->lines;
+    if (st->score_max < b->score)
+        st->score_max = b->score;
+    ++st->score_hist[sim_log2Bin(b->score)];
+    ++st->lines_hist[sim_log2Bin(b->lines)];
+    ++st->level_hist[(b->level < SIM_HIST_LEVEL) ? b->level : SIM_HIST_LEVEL - 1];
+}
+
+/// スレッド本体. ゲーム番号 no, no+T, no+2T.. を受け持つ.
+///
+static void sim_run(SimThread* t) {
+    ulonglong_t no;
+    for (no = t->no; no < s_games; no += s_threads)
+        sim_game(t, no);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI sim_threadProc(LPVOID arg) {
+    sim_run((SimThread*)arg);
+    return 0;
+}
+#else
+static void* sim_threadProc(void* arg) {
+    sim_run((SimThread*)arg);
+    return NULL;
+}
+#endif
+
+/// 全スレッドでシミュレーション.
+/// 作れなかったスレッドの分は自分で回す(結果はゲーム番号で決まるので変わらない).
+static void sim_runAll(void) {
+ #if defined(_WIN32)
+    HANDLE      th[SIM_THREAD_MAX];
+ #else
+    pthread_t   th[SIM_THREAD_MAX];
+ #endif
+    uint8_t     started[SIM_THREAD_MAX];
+    unsigned    i;
+    for (i = 0; i < s_threads; ++i) {
+        s_work[i].no = i;
+        memset(&s_work[i].stats, 0, sizeof(s_work[i].stats));
+    }
+    for (i = 1; i < s_threads; ++i) {   // 0 番は自分で回す.
+     #if defined(_WIN32)
+        th[i] = CreateThread(NULL, 0, sim_threadProc, &s_work[i], 0, NULL);
+        started[i] = (th[i] != NULL);
+     #else
+        started[i] = (pthread_create(&th[i], NULL, sim_threadProc, &s_work[i]) == 0);
+     #endif
+    }
+    sim_run(&s_work[0]);
+    for (i = 1; i < s_threads; ++i) {
+        if (!started[i]) {
+            fprintf(stderr, "otitame_sim: thread %u not started. Run on the main thread.\n", i);
+            sim_run(&s_work[i]);
+            continue;
+        }
+     #if defined(_WIN32)
+        WaitForSingleObject(th[i], INFINITE);
+        CloseHandle(th[i]);
+     #else
+        pthread_join(th[i], NULL);
+     #endif
+    }
+}
+
+/// コア数.
+///
+static unsigned sim_cpuNum(void) {
+ #if defined(_WIN32)
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return (unsigned)si.dwNumberOfProcessors;
+ #else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (unsigned)n : 1;
+ #endif
+}
+
+/// 経過時間計測用(秒).
+///
+static double sim_seconds(void) {
+ #if defined(_WIN32)
+    LARGE_INTEGER c, f;
+    QueryPerformanceCounter(&c);
+    QueryPerformanceFrequency(&f);
+    return (double)c.QuadPart / (double)f.QuadPart;
+ #else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+ #endif
+}
+
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+//  結果表示.
+
+/// スレッドごとの集計を total にまとめる.
+///
+static void sim_merge(SimStats* total) {
+    unsigned i, j;
+    memset(total, 0, sizeof(*total));
+    for (i = 0; i < s_threads; ++i) {
+        SimStats const* st = &s_work[i].stats;
+        total->games       += st->games;
+        total->placements  += st->placements;
+        total->clears      += st->clears;
+        total->capped      += st->capped;
+        total->score       += st->score;
+        total->land_score  += st->land_score;
+        total->clear_score += st->clear_score;
+        total->lines       += st->lines;
+        total->left_lines  += st->left_lines;
+        if (total->score_max < st->score_max)
+            total->score_max = st->score_max;
+        for (j = 0; j < SIM_HIST_LOG_N; ++j) {
+            total->score_hist[j] += st->score_hist[j];
+            total->lines_hist[j] += st->lines_hist[j];
+        }
+        for (j = 0; j < SIM_HIST_LEVEL; ++j)
+            total->level_hist[j] += st->level_hist[j];
+        for (j = 0; j <= FIELD_MAX_H; ++j)
+            total->bank_hist[j]  += st->bank_hist[j];
+    }
+}
+
+/// ヒストグラム表示. log2 なら区間を 2^(n-1)..2^n-1 で、そうでなければ値で表示.
+/// 最後の区間はそれ以上の値も含む.
+static void sim_printHist(char const* title, ulonglong_t const* h, unsigned n, bool log2) {
+    ulonglong_t total = 0, peak = 0;
+    unsigned    i;
+    for (i = 0; i < n; ++i) {
+        total += h[i];
+        if (peak < h[i])
+            peak = h[i];
+    }
+    printf("%s\n", title);
+    if (total == 0)
+        return;
+    for (i = 0; i < n; ++i) {
+        unsigned long lo = (log2 && i) ? 1UL << (i - 1) : i;
+        unsigned long hi = (log2 && i) ? (1UL << i) - 1 : i;
+        int           bar;
+        if (h[i] == 0)
+            continue;
+        bar = (int)(h[i] * 40 / peak);
+        if (log2)
+            printf("  %10lu..%-10lu", lo, hi);
+        else
+            printf("  %10lu%-12s", lo, (i == n - 1) ? "+" : "");
+        printf(" %6.2f%% %.*s\n", 100.0 * h[i] / total, bar
+                , "########################################");
+    }
+}
+
+/// 結果表示.
+///
+static void sim_print(SimStats const* st, double sec) {
+    double g = st->games ? (double)st->games : 1.0;
+    double s = st->score ? (double)st->score : 1.0;
+    printf("policy=%s games=%llu threads=%u field=%dx%d rand=%u seed=%lu maxp=%lu bank=%u\n"
+            , s_policy_names[s_policy], st->games, s_threads, s_field_w, s_field_h
+            , s_rand_policy, (unsigned long)s_seed, s_max_place, s_bank);
+    printf("time          : %.3f sec\n", sec);
+    printf("games/sec     : %.0f\n", st->games / sec);
+    printf("placements/sec: %.0f\n", st->placements / sec);
+    printf("placements    : %.1f / game, capped %llu\n", st->placements / g, st->capped);
+    printf("score         : %.2f / game, max %llu\n", st->score / g, st->score_max);
+    printf("  land(reached*reached) : %.2f / game (%.1f%%)\n"
+            , st->land_score / g, 100.0 * st->land_score / s);
+    printf("  clear(1+2+..+n)       : %.2f / game (%.1f%%)\n"
+            , st->clear_score / g, 100.0 * st->clear_score / s);
+    printf("lines         : %.2f / game, clears %.2f / game, left %.2f / game\n"
+            , st->lines / g, st->clears / g, st->left_lines / g);
+    sim_printHist("score histogram:", st->score_hist, SIM_HIST_LOG_N, 1);
+    sim_printHist("lines histogram:", st->lines_hist, SIM_HIST_LOG_N, 1);
+    sim_printHist("level histogram:", st->level_hist, SIM_HIST_LEVEL, 0);
+    sim_printHist("banked depth (pre_lines - lines) at clear:", st->bank_hist, FIELD_MAX_H + 1, 0);
+}
+
+
+//  -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -   -
+
+/// 範囲内に収めた数値オプション.
+///
+static long optNum(char const* a, long mi, long ma) {
+    long n = atol(a);
+    return (n < mi) ? mi : (n > ma) ? ma : n;
+}
+
+/// オプション取得.
+///
+static bool getOpt(char const* a) {
+    uint8_t i;
+    if (strncmp(a, "-fw", 3) == 0) {            // フィールド横幅.
+        s_field_w   = (pos_t)optNum(a+3, FIELD_MIN_W, FIELD_MAX_W);
+    } else if (strncmp(a, "-fh", 3) == 0) {     // フィールド縦幅.
+        s_field_h   = (pos_t)optNum(a+3, FIELD_MIN_H, FIELD_MAX_H);
+    } else if (strncmp(a, "-rand", 5) == 0) {   // ピースの選び方.
+        s_rand_policy = (uint8_t)optNum(a+5, 0, PIECE_RAND_POLICY_NUM-1);
+    } else if (strncmp(a, "-seed", 5) == 0) {   // 乱数の種.
+        s_seed      = strtoul(a+5, NULL, 0);
+    } else if (strncmp(a, "-maxp", 5) == 0) {   // 1ゲームの最大ピース数.
+        s_max_place = (unsigned long)optNum(a+5, 1, 0x7fffffffL);
+    } else if (strncmp(a, "-bank", 5) == 0) {   // bot が消すまでにタメる行数.
+        s_bank      = (uint8_t)optNum(a+5, 1, FIELD_MAX_H);
+    } else if (strncmp(a, "-g", 2) == 0) {      // ゲーム数.
+        s_games     = strtoull(a+2, NULL, 0);
+    } else if (strncmp(a, "-j", 2) == 0) {      // スレッド数.
+        s_threads   = (unsigned)optNum(a+2, 0, SIM_THREAD_MAX);
+    } else if (strncmp(a, "-p", 2) == 0) {      // 置き方の方針.
+        for (i = 0; i < SIM_POLICY_NUM && strcmp(a+2, s_policy_names[i]); ++i)
+            ;
+        if (i >= SIM_POLICY_NUM)
+            return 0;
+        s_policy    = i;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/// Main
+///
+int main(int argc, char* argv[]) {
+    SimStats total;
+    double   sec;
+    int      i;
+    for (i = 1; i < argc; ++i) {
+        if (!getOpt(argv[i])) {
+            fprintf(stderr, "usage: otitame_sim [-gN] [-jN] [-p{random|greedy|bot}]"
+                            " [-fwN] [-fhN] [-randN] [-seedN] [-maxpN] [-bankN]\n");
+            return 1;
+        }
+    }
+    if (s_threads == 0)
+        s_threads = sim_cpuNum();
+    if (s_threads > SIM_THREAD_MAX)
+        s_threads = SIM_THREAD_MAX;
+    if (s_seed == 0)
+        s_seed = (uint32_t)time(NULL);
+    sim_initShapes();
+
+    sec = sim_seconds();
+    sim_runAll();
+    sec = sim_seconds() - sec;
+    if (sec <= 0)
+        sec = 1e-9;
+
+    sim_merge(&total);
+    sim_print(&total, sec);
+    return 0;
+}
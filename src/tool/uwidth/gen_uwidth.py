@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+# Generate src/cons/cons_uwidth.c (East Asian Width table) from Python's unicodedata.
+#   usage: python3 gen_uwidth.py > ../../cons/cons_uwidth.c
+import sys
+import unicodedata
+
+PAGE_SHIFT = 7
+PAGE_SIZE  = 1 << PAGE_SHIFT
+TABLE_END  = 0x20000            # Code points above are classified in code.
+
+NARROW, WIDE, AMBI, ZERO = 0, 1, 2, 3
+
+def width_class(cp):
+    c   = chr(cp)
+    cat = unicodedata.category(c)
+    if cat in ('Mn', 'Me') or (cat == 'Cf' and cp != 0xAD) or 0x1160 <= cp <= 0x11FF or cp == 0x200B:
+        return ZERO
+    eaw = unicodedata.east_asian_width(c)
+    if eaw in ('W', 'F'):
+        return WIDE
+    if eaw == 'A':
+        return AMBI
+    return NARROW
+
+blocks = {}
+pages  = []
+for p in range(TABLE_END >> PAGE_SHIFT):
+    b = bytes(sum(width_class(p * PAGE_SIZE + i * 4 + k) << (2 * k) for k in range(4))
+              for i in range(PAGE_SIZE // 4))
+    if b not in blocks:
+        blocks[b] = len(blocks)
+    pages.append(blocks[b])
+assert len(blocks) <= 256
+
+out = sys.stdout
+out.write('''/**
+ *  @file cons_uwidth.c
+ *  @brief East Asian Width of unicode code points.
+ *  @author Masashi Kitamura ( https://github.com/tenk-a/ )
+ *  @date   2026-10
+ *  @license Boost Software License - Version 1.0
+ *  @note
+ *   Generated by src/tool/uwidth/gen_uwidth.py (Unicode %s). Do not edit.
+ */
+#include "cons_uwidth.h"
+
+/** (code point >> %d) -> block.
+ */
+static unsigned char const s_uwPage[0x%x] = {
+''' % (unicodedata.unidata_version, PAGE_SHIFT, len(pages)))
+for i in range(0, len(pages), 16):
+    out.write('    ' + ','.join('%3d' % v for v in pages[i:i+16]) + ',\n')
+out.write('''};
+
+/** 2 bits per code point. CONS_UW_NARROW, CONS_UW_WIDE, CONS_UW_AMBI or CONS_UW_ZERO.
+ */
+static unsigned char const s_uwBlock[%d][%d] = {
+''' % (len(blocks), PAGE_SIZE // 4))
+for b in sorted(blocks, key=lambda k: blocks[k]):
+    for i in range(0, len(b), 16):
+        out.write('    ' + ('{ ' if i == 0 else '  ') + ','.join('0x%02x' % v for v in b[i:i+16])
+                  + (' },' if i + 16 >= len(b) else ',') + '\n')
+out.write('''};
+
+/** Width class of code point cp.
+ */
+unsigned cons_uwidthClass(unsigned long cp) {
+    if (cp < 0x%x)
+        return (s_uwBlock[s_uwPage[cp >> %d]][(cp & 0x%x) >> 2] >> ((cp & 3) << 1)) & 3;
+    if (cp <= 0x3FFFD)
+        return CONS_UW_WIDE;        // CJK Ext. B and later.
+    if (cp == 0xE0001 || (cp >= 0xE0020 && cp <= 0xE007F) || (cp >= 0xE0100 && cp <= 0xE01EF))
+        return CONS_UW_ZERO;        // Tags, variation selectors.
+    if (cp >= 0xF0000 && cp <= 0x10FFFD)
+        return CONS_UW_AMBI;        // Private use.
+    return CONS_UW_NARROW;
+}
+''' % (TABLE_END, PAGE_SHIFT, PAGE_SIZE - 1))